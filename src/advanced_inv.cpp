@@ -359,8 +359,8 @@ void advanced_inventory::print_items( const advanced_inventory_pane &pane, bool
          x < itemsPerPage ; i++, x++ ) {
         const auto &sitem = items[i];
         if( sitem.is_category_header() ) {
-            mvwprintz( window, point( ( columns - utf8_width( sitem.name ) - 6 ) / 2, 6 + x ), c_cyan, "[%s]",
-                       sitem.name );
+            mvwprintz( window, point( ( columns - utf8_width( sitem.get_name() ) - 6 ) / 2, 6 + x ),
+                       c_cyan, "[%s]", sitem.get_name() );
             continue;
         }
         if( !sitem.is_item_entry() ) {
@@ -464,7 +464,7 @@ void advanced_inventory::print_items( const advanced_inventory_pane &pane, bool
         }
         mvwprintz( window, point( vol_startpos, 6 + x ), print_color, it_vol );
 
-        if( active && sitem.autopickup ) {
+        if( active && sitem.is_autopickup() ) {
             mvwprintz( window, point( 1, 6 + x ), magenta_background( it.color_in_inventory() ),
                        compact ? it.tname().substr( 0, 1 ) : ">" );
         }
@@ -571,14 +571,14 @@ struct advanced_inv_sorter {
         // secondary sort by name
         const std::string *n1;
         const std::string *n2;
-        if( d1.name_without_prefix == d2.name_without_prefix ) {
+        if( d1.get_name_without_prefix() == d2.get_name_without_prefix() ) {
             //if names without prefix equal, compare full name
-            n1 = &d1.name;
-            n2 = &d2.name;
+            n1 = &d1.get_name();
+            n2 = &d2.get_name();
         } else {
             //else compare name without prefix
-            n1 = &d1.name_without_prefix;
-            n2 = &d2.name_without_prefix;
+            n1 = &d1.get_name_without_prefix();
+            n2 = &d2.get_name_without_prefix();
         }
         return std::lexicographical_compare( n1->begin(), n1->end(),
                                              n2->begin(), n2->end(), sort_case_insensitive_less() );
@@ -1042,6 +1042,7 @@ bool advanced_inventory::show_sort_menu( advanced_inventory_pane &pane )
 
 void advanced_inventory::display()
 {
+    const item::name_cache_scope names;
     init();
 
     g->u.inv.restack( g->u );
@@ -1395,12 +1396,12 @@ void advanced_inventory::display()
             if( sitem == nullptr || !sitem->is_item_entry() ) {
                 continue;
             }
-            if( sitem->autopickup ) {
+            if( sitem->is_autopickup() ) {
                 get_auto_pickup().remove_rule( sitem->items.front() );
-                sitem->autopickup = false;
+                sitem->set_autopickup( false );
             } else {
                 get_auto_pickup().add_rule( sitem->items.front() );
-                sitem->autopickup = true;
+                sitem->set_autopickup( true );
             }
             recalc = true;
         } else if( action == "EXAMINE" ) {
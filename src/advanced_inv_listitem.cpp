@@ -36,9 +36,6 @@ advanced_inv_listitem::advanced_inv_listitem( item *an_item, int index, int coun
     : idx( index )
     , area( area )
     , id( an_item->typeId() )
-    , name( an_item->tname( count ) )
-    , name_without_prefix( an_item->tname( 1, false ) )
-    , autopickup( get_auto_pickup().has_rule( an_item ) )
     , stacks( count )
     , volume( an_item->volume() * stacks )
     , weight( an_item->weight() * stacks )
@@ -55,9 +52,6 @@ advanced_inv_listitem::advanced_inv_listitem( const std::list<item *> &list, int
     area( area ),
     id( list.front()->typeId() ),
     items( list ),
-    name( list.front()->tname( list.size() ) ),
-    name_without_prefix( list.front()->tname( 1, false ) ),
-    autopickup( get_auto_pickup().has_rule( list.front() ) ),
     stacks( list.size() ),
     volume( list.front()->volume() * stacks ),
     weight( list.front()->weight() * stacks ),
@@ -71,7 +65,6 @@ advanced_inv_listitem::advanced_inv_listitem()
     : idx()
     , area()
     , id( "null" )
-    , autopickup()
     , stacks()
     , cat( nullptr )
 {
@@ -81,11 +74,39 @@ advanced_inv_listitem::advanced_inv_listitem( const item_category *cat )
     : idx()
     , area()
     , id( "null" )
-    , name( cat->name() )
-    , autopickup()
     , stacks()
     , cat( cat )
+    , name( cat->name() )
+{
+}
+
+const std::string &advanced_inv_listitem::get_name() const
+{
+    if( !name ) {
+        name = items.empty() ? std::string() : items.front()->tname( stacks );
+    }
+    return *name;
+}
+
+const std::string &advanced_inv_listitem::get_name_without_prefix() const
+{
+    if( !name_without_prefix ) {
+        name_without_prefix = items.empty() ? std::string() : items.front()->tname( 1, false );
+    }
+    return *name_without_prefix;
+}
+
+bool advanced_inv_listitem::is_autopickup() const
+{
+    if( !autopickup ) {
+        autopickup = !items.empty() && get_auto_pickup().has_rule( items.front() );
+    }
+    return *autopickup;
+}
+
+void advanced_inv_listitem::set_autopickup( const bool autopickup )
 {
+    this->autopickup = autopickup;
 }
 
 bool advanced_inv_listitem::is_category_header() const
@@ -5,6 +5,8 @@
 #include <list>
 #include <string>
 
+#include "optional.h"
+
 // see item_factory.h
 class item;
 class item_category;
@@ -32,18 +34,6 @@ class advanced_inv_listitem
         itype_id id;
         // The list of items, and empty when a header
         std::list<item *> items;
-        /**
-         * The displayed name of the item/the category header.
-         */
-        std::string name;
-        /**
-         * Name of the item (singular) without damage (or similar) prefix, used for sorting.
-         */
-        std::string name_without_prefix;
-        /**
-         * Whether auto pickup is enabled for this item (based on the name).
-         */
-        bool autopickup = false;
         /**
          * The stack count represented by this item, should be >= 1, should be 1
          * for anything counted by charges.
@@ -65,6 +55,19 @@ class advanced_inv_listitem
          * Is the item stored in a vehicle?
          */
         bool from_vehicle = false;
+        /**
+         * The displayed name of the item/the category header.
+         */
+        const std::string &get_name() const;
+        /**
+         * Name of the item (singular) without damage (or similar) prefix, used for sorting.
+         */
+        const std::string &get_name_without_prefix() const;
+        /**
+         * Whether auto pickup is enabled for this item (based on the name).
+         */
+        bool is_autopickup() const;
+        void set_autopickup( bool autopickup );
         /**
          * Whether this is a category header entry, which does *not* have a reference
          * to an item, only @ref cat is valid.
@@ -101,5 +104,11 @@ class advanced_inv_listitem
          */
         advanced_inv_listitem( const std::list<item *> &list, int index,
                                aim_location area, bool from_vehicle );
+    private:
+        // Looked up on first use: a pane can list thousands of items, but only draws a page
+        // of them, and the names are only compared when sorting by name or on ties.
+        mutable cata::optional<std::string> name;
+        mutable cata::optional<std::string> name_without_prefix;
+        mutable cata::optional<bool> autopickup;
 };
 #endif
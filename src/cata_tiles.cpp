@@ -7,8 +7,10 @@
 #include <array>
 #include <cassert>
 #include <fstream>
+#include <functional>
 #include <bitset>
 #include <iterator>
+#include <numeric>
 #include <stdexcept>
 #include <tuple>
 #include <set>
@@ -21,6 +23,7 @@
 #include "debug.h"
 #include "field.h"
 #include "game.h"
+#include "hash_utils.h"
 #include "item.h"
 #include "item_factory.h"
 #include "itype.h"
@@ -172,6 +175,264 @@ formatted_text::formatted_text( const std::string &text, const int color,
     }
 }
 
+static int divide_round_down( int a, int b )
+{
+    if( b < 0 ) {
+        a = -a;
+        b = -b;
+    }
+    if( a >= 0 ) {
+        return a / b;
+    } else {
+        return -( ( -a + b - 1 ) / b );
+    }
+}
+
+// Width and height in tiles of the chunks of the retained map layer
+static constexpr int map_layer_chunk_tiles = 8;
+
+bool retained_map_layer::begin( const SDL_Renderer_Ptr &renderer, const SDL_Rect &screen_area,
+                                const point &tile_pixels )
+{
+    commands.clear();
+    recording = false;
+    if( screen_area.w <= 0 || screen_area.h <= 0 || tile_pixels.x <= 0 || tile_pixels.y <= 0 ) {
+        return false;
+    }
+    recording = true;
+    if( screen_area.w != area.w || screen_area.h != area.h ) {
+        // Only tried once per size, a renderer without render targets keeps drawing directly
+        target = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                screen_area.w, screen_area.h );
+        if( target ) {
+            SetTextureBlendMode( target, SDL_BLENDMODE_NONE );
+        }
+        chunk_hashes.clear();
+    }
+    area = screen_area;
+    tile_size = tile_pixels;
+    const point chunk_pixels( map_layer_chunk_tiles * tile_pixels.x,
+                              map_layer_chunk_tiles * tile_pixels.y );
+    if( chunk_pixels != chunk_size ) {
+        chunk_size = chunk_pixels;
+        chunk_hashes.clear();
+    }
+    chunk_count = point( divide_round_up( area.w, chunk_size.x ),
+                         divide_round_up( area.h, chunk_size.y ) );
+    return static_cast<bool>( target );
+}
+
+void retained_map_layer::render_command( const SDL_Renderer_Ptr &renderer,
+        const draw_command &cmd, const point &offset ) const
+{
+    SDL_Rect dest = cmd.dest;
+    dest.x += offset.x;
+    dest.y += offset.y;
+    if( cmd.tex == nullptr ) {
+        render_fill_rect( renderer, dest, cmd.color.r, cmd.color.g, cmd.color.b );
+    } else {
+        printErrorIf( cmd.tex->render_copy_ex( renderer, &dest, cmd.angle, nullptr, cmd.flip ) != 0,
+                      "SDL_RenderCopyEx() failed" );
+    }
+}
+
+void retained_map_layer::flush_batch( const SDL_Renderer_Ptr &renderer )
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if( !batch_indices.empty() ) {
+        printErrorIf( SDL_RenderGeometry( renderer.get(), batch_atlas, batch_vertices.data(),
+                                          batch_vertices.size(), batch_indices.data(),
+                                          batch_indices.size() ) != 0,
+                      "SDL_RenderGeometry() failed" );
+    }
+    batch_atlas = nullptr;
+    batch_vertices.clear();
+    batch_indices.clear();
+#else
+    ( void ) renderer;
+#endif
+}
+
+void retained_map_layer::submit( const SDL_Renderer_Ptr &renderer,
+                                 const std::vector<size_t> &indices, const SDL_Rect &bounds,
+                                 const point &offset )
+{
+    // The layer of a command is one above the commands with another atlas that were drawn
+    // before it at the same place, or the same as those with the same atlas. Overlaps are
+    // tracked per tile sized cell, each cell keeps the layer and atlas last drawn into it.
+    const point cells( divide_round_up( bounds.w, tile_size.x ),
+                       divide_round_up( bounds.h, tile_size.y ) );
+    cell_tops.assign( cells.x * cells.y, std::make_pair( -1, nullptr ) );
+    batch_order.clear();
+    for( const size_t i : indices ) {
+        const draw_command &cmd = commands[i];
+        const point top_left( cmd.dest.x + offset.x - bounds.x, cmd.dest.y + offset.y - bounds.y );
+        const int min_x = std::max( 0, divide_round_down( top_left.x, tile_size.x ) );
+        const int min_y = std::max( 0, divide_round_down( top_left.y, tile_size.y ) );
+        const int max_x = std::min( cells.x - 1,
+                                    divide_round_down( top_left.x + cmd.dest.w - 1, tile_size.x ) );
+        const int max_y = std::min( cells.y - 1,
+                                    divide_round_down( top_left.y + cmd.dest.h - 1, tile_size.y ) );
+        if( cmd.dest.w <= 0 || cmd.dest.h <= 0 || min_x > max_x || min_y > max_y ) {
+            continue;
+        }
+        SDL_Texture *const atlas = cmd.tex == nullptr ? nullptr : cmd.tex->atlas();
+        int layer = 0;
+        for( int y = min_y; y <= max_y; ++y ) {
+            for( int x = min_x; x <= max_x; ++x ) {
+                const std::pair<int, SDL_Texture *> &top = cell_tops[x + y * cells.x];
+                if( top.first >= 0 ) {
+                    layer = std::max( layer, top.second == atlas ? top.first : top.first + 1 );
+                }
+            }
+        }
+        for( int y = min_y; y <= max_y; ++y ) {
+            for( int x = min_x; x <= max_x; ++x ) {
+                cell_tops[x + y * cells.x] = std::make_pair( layer, atlas );
+            }
+        }
+        batch_order.push_back( { layer, atlas, i } );
+    }
+    // Stable, so the commands of one atlas on one layer keep their order
+    std::stable_sort( batch_order.begin(), batch_order.end(),
+    []( const batch_entry & lhs, const batch_entry & rhs ) {
+        if( lhs.layer != rhs.layer ) {
+            return lhs.layer < rhs.layer;
+        }
+        return std::less<SDL_Texture *>()( lhs.atlas, rhs.atlas );
+    } );
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    point atlas_size;
+    for( const batch_entry &entry : batch_order ) {
+        const draw_command &cmd = commands[entry.command];
+        // Rotated sprites are rare, they are rendered one at a time
+        if( entry.atlas == nullptr || cmd.angle != 0 ) {
+            flush_batch( renderer );
+            render_command( renderer, cmd, offset );
+            continue;
+        }
+        if( entry.atlas != batch_atlas ) {
+            flush_batch( renderer );
+            batch_atlas = entry.atlas;
+            printErrorIf( SDL_QueryTexture( batch_atlas, nullptr, nullptr, &atlas_size.x,
+                                            &atlas_size.y ) != 0, "SDL_QueryTexture() failed" );
+        }
+        const SDL_Rect &src = cmd.tex->atlas_rect();
+        float u0 = static_cast<float>( src.x ) / atlas_size.x;
+        float u1 = static_cast<float>( src.x + src.w ) / atlas_size.x;
+        float v0 = static_cast<float>( src.y ) / atlas_size.y;
+        float v1 = static_cast<float>( src.y + src.h ) / atlas_size.y;
+        if( cmd.flip & SDL_FLIP_HORIZONTAL ) {
+            std::swap( u0, u1 );
+        }
+        if( cmd.flip & SDL_FLIP_VERTICAL ) {
+            std::swap( v0, v1 );
+        }
+        const float x0 = cmd.dest.x + offset.x;
+        const float y0 = cmd.dest.y + offset.y;
+        const float x1 = x0 + cmd.dest.w;
+        const float y1 = y0 + cmd.dest.h;
+        const SDL_Color white = { 255, 255, 255, 255 };
+        const int first = batch_vertices.size();
+        batch_vertices.push_back( { { x0, y0 }, white, { u0, v0 } } );
+        batch_vertices.push_back( { { x1, y0 }, white, { u1, v0 } } );
+        batch_vertices.push_back( { { x1, y1 }, white, { u1, v1 } } );
+        batch_vertices.push_back( { { x0, y1 }, white, { u0, v1 } } );
+        for( const int corner : { 0, 1, 2, 2, 3, 0 } ) {
+            batch_indices.push_back( first + corner );
+        }
+    }
+    flush_batch( renderer );
+#else
+    // Without batched geometry, binding each atlas once is all that is gained
+    for( const batch_entry &entry : batch_order ) {
+        render_command( renderer, commands[entry.command], offset );
+    }
+#endif
+}
+
+void retained_map_layer::finish( const SDL_Renderer_Ptr &renderer )
+{
+    recording = false;
+    if( !target ) {
+        std::vector<size_t> all( commands.size() );
+        std::iota( all.begin(), all.end(), 0 );
+        submit( renderer, all, area, point_zero );
+        return;
+    }
+    const size_t num_chunks = chunk_count.x * chunk_count.y;
+    chunk_commands.resize( num_chunks );
+    for( std::vector<size_t> &chunk : chunk_commands ) {
+        chunk.clear();
+    }
+    std::vector<size_t> hashes( num_chunks, 0 );
+    for( size_t i = 0; i < commands.size(); ++i ) {
+        const draw_command &cmd = commands[i];
+        // Relative to the area, as the texture is
+        const point top_left( cmd.dest.x - area.x, cmd.dest.y - area.y );
+        const int min_x = std::max( 0, divide_round_down( top_left.x, chunk_size.x ) );
+        const int min_y = std::max( 0, divide_round_down( top_left.y, chunk_size.y ) );
+        const point bottom_right = top_left + point( cmd.dest.w - 1, cmd.dest.h - 1 );
+        const int max_x = std::min( chunk_count.x - 1,
+                                    divide_round_down( bottom_right.x, chunk_size.x ) );
+        const int max_y = std::min( chunk_count.y - 1,
+                                    divide_round_down( bottom_right.y, chunk_size.y ) );
+        if( cmd.dest.w <= 0 || cmd.dest.h <= 0 || min_x > max_x || min_y > max_y ) {
+            continue;
+        }
+        size_t cmd_hash = 0;
+        cata::hash_combine( cmd_hash, cmd.tex );
+        cata::hash_combine( cmd_hash, top_left.x );
+        cata::hash_combine( cmd_hash, top_left.y );
+        cata::hash_combine( cmd_hash, cmd.dest.w );
+        cata::hash_combine( cmd_hash, cmd.dest.h );
+        cata::hash_combine( cmd_hash, cmd.angle );
+        cata::hash_combine( cmd_hash, static_cast<int>( cmd.flip ) );
+        cata::hash_combine( cmd_hash, ( cmd.color.r << 16 ) | ( cmd.color.g << 8 ) | cmd.color.b );
+        for( int y = min_y; y <= max_y; ++y ) {
+            for( int x = min_x; x <= max_x; ++x ) {
+                const size_t chunk = x + y * chunk_count.x;
+                chunk_commands[chunk].push_back( i );
+                cata::hash_combine( hashes[chunk], cmd_hash );
+            }
+        }
+    }
+
+    bool changed = false;
+    for( size_t chunk = 0; chunk < num_chunks; ++chunk ) {
+        if( chunk < chunk_hashes.size() && chunk_hashes[chunk] == hashes[chunk] ) {
+            continue;
+        }
+        if( !changed ) {
+            SetRenderTarget( renderer, target );
+            changed = true;
+        }
+        const int x = chunk % chunk_count.x * chunk_size.x;
+        const int y = chunk / chunk_count.x * chunk_size.y;
+        const SDL_Rect chunk_rect = { x, y, std::min( chunk_size.x, area.w - x ),
+                                      std::min( chunk_size.y, area.h - y )
+                                    };
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &chunk_rect ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        render_fill_rect( renderer, chunk_rect, 0, 0, 0 );
+        submit( renderer, chunk_commands[chunk], chunk_rect, point( -area.x, -area.y ) );
+    }
+    chunk_hashes.swap( hashes );
+
+    if( changed ) {
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        set_displaybuffer_rendertarget();
+    }
+    RenderCopy( renderer, target, nullptr, &area );
+}
+
+void retained_map_layer::invalidate()
+{
+    chunk_hashes.clear();
+}
+
 cata_tiles::cata_tiles( const SDL_Renderer_Ptr &renderer ) :
     renderer( renderer ),
     minimap( renderer )
@@ -205,6 +466,7 @@ cata_tiles::~cata_tiles() = default;
 void cata_tiles::on_options_changed()
 {
     memory_map_mode = get_option <std::string>( "MEMORY_MAP_MODE" );
+    map_layer.invalidate();
 
     pixel_minimap_settings settings;
 
@@ -235,6 +497,8 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
                                const bool force )
 {
     if( tileset_ptr && tileset_ptr->get_tileset_id() == tileset_id && !force ) {
+        // The game data may have been reloaded since
+        resolve_tiles();
         return;
     }
     // TODO: move into clear or somewhere else.
@@ -247,6 +511,9 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_loader loader( *new_tileset_ptr, renderer );
     loader.load( tileset_id, precheck );
     tileset_ptr = std::move( new_tileset_ptr );
+    // The sprites of the old tileset are gone, even if the new ones end up at the same addresses
+    map_layer.invalidate();
+    resolve_tiles();
 
     set_draw_scale( 16 );
 
@@ -973,19 +1240,6 @@ struct tile_render_info {
     }
 };
 
-static int divide_round_down( int a, int b )
-{
-    if( b < 0 ) {
-        a = -a;
-        b = -b;
-    }
-    if( a >= 0 ) {
-        return a / b;
-    } else {
-        return -( ( -a + b - 1 ) / b );
-    }
-}
-
 void cata_tiles::draw( const point &dest, const tripoint &center, int width, int height,
                        std::multimap<point, formatted_text> &overlay_strings,
                        color_block_overlay_container &color_blocks )
@@ -1007,8 +1261,11 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
                       "SDL_RenderSetClipRect failed" );
 
-        //fill render area with black to prevent artifacts where no new pixels are drawn
-        render_fill_rect( renderer, clipRect, 0, 0, 0 );
+        // The map layer is drawn over the whole area when it is finished, otherwise
+        // fill render area with black to prevent artifacts where no new pixels are drawn
+        if( !map_layer.begin( renderer, clipRect, point( tile_width, tile_height ) ) ) {
+            render_fill_rect( renderer, clipRect, 0, 0, 0 );
+        }
     }
 
     int sx = 0;
@@ -1364,6 +1621,14 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
+    if( map_layer.is_recording() ) {
+        map_layer.finish( renderer );
+        // Switching render targets dropped the clipping
+        SDL_Rect clipRect = {dest.x, dest.y, width, height};
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+    }
+
     in_animation = do_draw_explosion || do_draw_custom_explosion ||
                    do_draw_bullet || do_draw_hit || do_draw_line ||
                    do_draw_cursor || do_draw_highlight || do_draw_weather ||
@@ -1469,13 +1734,19 @@ bool cata_tiles::draw_from_id_string( std::string id, const tripoint &pos, int s
 }
 
 const tile_type *cata_tiles::find_tile_with_season( std::string &id )
+{
+    return find_tile_with_season( id, season_of_year( calendar::turn ) );
+}
+
+const tile_type *cata_tiles::find_tile_with_season( std::string &id,
+        const season_type season ) const
 {
     constexpr size_t suffix_len = 15;
     constexpr char season_suffix[4][suffix_len] = {
         "_season_spring", "_season_summer", "_season_autumn", "_season_winter"
     };
 
-    std::string seasonal_id = id + season_suffix[season_of_year( calendar::turn )];
+    std::string seasonal_id = id + season_suffix[season];
 
     const tile_type *tt = tileset_ptr->find_tile_type( seasonal_id );
     if( tt ) {
@@ -1487,10 +1758,16 @@ const tile_type *cata_tiles::find_tile_with_season( std::string &id )
 }
 
 const tile_type *cata_tiles::find_tile_looks_like( std::string &id, TILE_CATEGORY category )
+{
+    return find_tile_looks_like( id, category, season_of_year( calendar::turn ) );
+}
+
+const tile_type *cata_tiles::find_tile_looks_like( std::string &id, TILE_CATEGORY category,
+        const season_type season ) const
 {
     std::string looks_like = id;
     for( int cnt = 0; cnt < 10 && !looks_like.empty(); cnt++ ) {
-        const tile_type *lltt = find_tile_with_season( looks_like );
+        const tile_type *lltt = find_tile_with_season( looks_like, season );
         if( lltt ) {
             id = looks_like;
             return lltt;
@@ -1548,6 +1825,95 @@ const tile_type *cata_tiles::find_tile_looks_like( std::string &id, TILE_CATEGOR
     return nullptr;
 }
 
+resolved_tile::variant cata_tiles::resolve_tile_variant( std::string id, TILE_CATEGORY category,
+        const season_type season ) const
+{
+    resolved_tile::variant ret;
+    ret.tt = find_tile_looks_like( id, category, season );
+    ret.id = id;
+    if( category == C_FURNITURE ) {
+        const furn_str_id fid( id );
+        ret.immovable_furniture = fid.is_valid() && !fid.obj().is_movable();
+    }
+    return ret;
+}
+
+resolved_tile cata_tiles::resolve_tile( const std::string &id, TILE_CATEGORY category,
+                                        const season_type season ) const
+{
+    resolved_tile ret;
+    ret.tile = resolve_tile_variant( id, category, season );
+    if( ret.tile.tt == nullptr ) {
+        return ret;
+    }
+    ret.usable = true;
+    if( !ret.tile.tt->multitile ) {
+        return ret;
+    }
+    const std::vector<std::string> &available = ret.tile.tt->available_subtiles;
+    for( size_t i = 0; i < multitile_keys.size(); ++i ) {
+        const std::string &key = multitile_keys[i];
+        if( std::find( available.begin(), available.end(), key ) == available.end() ) {
+            continue;
+        }
+        ret.subtiles[i] = resolve_tile_variant( ret.tile.id + "_" + key, category, season );
+        ret.usable &= ret.subtiles[i].tt != nullptr;
+    }
+    return ret;
+}
+
+void cata_tiles::resolve_tiles()
+{
+    for( int i = 0; i < NUM_SEASONS; ++i ) {
+        const season_type season = static_cast<season_type>( i );
+        resolved_tile_lookups &lookups = resolved_tiles[i];
+        lookups = resolved_tile_lookups();
+        if( !tileset_ptr ) {
+            continue;
+        }
+        for( size_t id = 0; id < ter_t::count(); ++id ) {
+            lookups.terrain.emplace_back( resolve_tile( ter_id( id ).id().str(), C_TERRAIN,
+                                          season ) );
+        }
+        for( size_t id = 0; id < furn_t::count(); ++id ) {
+            lookups.furniture.emplace_back( resolve_tile( furn_id( id ).id().str(), C_FURNITURE,
+                                            season ) );
+        }
+        for( size_t id = 0; id < field_type::count(); ++id ) {
+            lookups.fields.emplace_back( resolve_tile( field_type_id( id ).id().str(), C_FIELD,
+                                         season ) );
+        }
+        for( const mtype &type : MonsterGenerator::generator().get_all_mtypes() ) {
+            lookups.monsters.emplace( &type, resolve_tile( type.id.str(), C_MONSTER, season ) );
+        }
+        for( const auto &vp : vpart_info::all() ) {
+            lookups.vehicle_parts.emplace( &vp.second, resolve_tile( "vp_" + vp.first.str(),
+                                           C_VEHICLE_PART, season ) );
+        }
+    }
+}
+
+const resolved_tile_lookups &cata_tiles::current_resolved_tiles() const
+{
+    return resolved_tiles[season_of_year( calendar::turn )];
+}
+
+// The usable tile at @p index of @p tiles, if any
+static const resolved_tile *find_resolved_tile( const std::vector<resolved_tile> &tiles,
+        const size_t index )
+{
+    return index < tiles.size() && tiles[index].usable ? &tiles[index] : nullptr;
+}
+
+// The usable tile for @p key in @p tiles, if any
+template<typename T>
+static const resolved_tile *find_resolved_tile(
+    const std::unordered_map<const T *, resolved_tile> &tiles, const T *key )
+{
+    const auto iter = tiles.find( key );
+    return iter != tiles.end() && iter->second.usable ? &iter->second : nullptr;
+}
+
 bool cata_tiles::find_overlay_looks_like( const bool male, const std::string &overlay,
         std::string &draw_id )
 {
@@ -1781,6 +2147,35 @@ bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
         }
     }
 
+    bool immovable_furniture = false;
+    if( category == C_FURNITURE ) {
+        const furn_str_id fid( id );
+        immovable_furniture = fid.is_valid() && !fid.obj().is_movable();
+    }
+    return draw_tile_type_at( display_tile, id, category, pos, rota, ll,
+                              apply_night_vision_goggles, height_3d, immovable_furniture );
+}
+
+bool cata_tiles::draw_resolved_tile( const resolved_tile &rt, TILE_CATEGORY category,
+                                     const tripoint &pos, int subtile, int rota, lit_level ll,
+                                     bool apply_night_vision_goggles, int &height_3d )
+{
+    rectangle screen_bounds( o, o + point( screentile_width, screentile_height ) );
+    if( !tile_iso &&
+        !screen_bounds.contains_half_open( pos.xy() ) ) {
+        return false;
+    }
+    const resolved_tile::variant &picked = subtile != -1 && rt.subtiles[subtile].tt != nullptr ?
+                                           rt.subtiles[subtile] : rt.tile;
+    return draw_tile_type_at( *picked.tt, picked.id, category, pos, rota, ll,
+                              apply_night_vision_goggles, height_3d, picked.immovable_furniture );
+}
+
+bool cata_tiles::draw_tile_type_at( const tile_type &display_tile, const std::string &id,
+                                    TILE_CATEGORY category, const tripoint &pos, int rota,
+                                    lit_level ll, bool apply_night_vision_goggles, int &height_3d,
+                                    const bool immovable_furniture )
+{
     // translate from player-relative to screen relative tile position
     const point screen_pos = player_to_screen( pos.xy() );
 
@@ -1821,20 +2216,15 @@ bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
 
         }
         break;
-        case C_FURNITURE: {
+        case C_FURNITURE:
             // If the furniture is not movable, we'll allow seeding by the position
             // since we won't get the behavior that occurs where the tile constantly
             // changes when the player grabs the furniture and drags it, causing the
             // seed to change.
-            const furn_str_id fid( id );
-            if( fid.is_valid() ) {
-                const furn_t &f = fid.obj();
-                if( !f.is_movable() ) {
-                    seed = g->m.getabs( pos ).x + g->m.getabs( pos ).y * 65536;
-                }
+            if( immovable_furniture ) {
+                seed = g->m.getabs( pos ).x + g->m.getabs( pos ).y * 65536;
             }
-        }
-        break;
+            break;
         case C_ITEM:
         case C_TRAP:
         case C_NONE:
@@ -1986,7 +2376,7 @@ bool cata_tiles::draw_sprite_at(
             default:
             case 0:
                 // unrotated (and 180, with just two sprites)
-                ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+                ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                 break;
             case 1:
                 // 90 degrees (and 270, with just two sprites)
@@ -1995,19 +2385,20 @@ bool cata_tiles::draw_sprite_at(
 #endif
                 if( !tile_iso ) {
                     // never rotate isometric tiles
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr, SDL_FLIP_NONE );
+                    ret = render_sprite( *sprite_tex, destination, -90, SDL_FLIP_NONE );
                 } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+                    ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                 }
                 break;
             case 2:
                 // 180 degrees, implemented with flips instead of rotation
                 if( !tile_iso ) {
                     // never flip isometric tiles vertically
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
+                    ret = render_sprite( *sprite_tex, destination, 0,
+                                         static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL |
+                                                 SDL_FLIP_VERTICAL ) );
                 } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+                    ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                 }
                 break;
             case 3:
@@ -2017,19 +2408,19 @@ bool cata_tiles::draw_sprite_at(
 #endif
                 if( !tile_iso ) {
                     // never rotate isometric tiles
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr, SDL_FLIP_NONE );
+                    ret = render_sprite( *sprite_tex, destination, 90, SDL_FLIP_NONE );
                 } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+                    ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
                 }
                 break;
             case 4:
                 // flip horizontally
-                ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                  static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
+                ret = render_sprite( *sprite_tex, destination, 0,
+                                     static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
         }
     } else {
         // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+        ret = render_sprite( *sprite_tex, destination, 0, SDL_FLIP_NONE );
     }
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
@@ -2040,6 +2431,25 @@ bool cata_tiles::draw_sprite_at(
     return true;
 }
 
+int cata_tiles::render_sprite( const texture &tex, const SDL_Rect &dest, const int angle,
+                               const SDL_RendererFlip flip )
+{
+    if( map_layer.is_recording() ) {
+        map_layer.record( { &tex, dest, angle, flip, SDL_Color{ 0, 0, 0, 0 } } );
+        return 0;
+    }
+    return tex.render_copy_ex( renderer, &dest, angle, nullptr, flip );
+}
+
+void cata_tiles::render_rect( const SDL_Rect &rect, const SDL_Color &color )
+{
+    if( map_layer.is_recording() ) {
+        map_layer.record( { nullptr, rect, 0, SDL_FLIP_NONE, color } );
+        return;
+    }
+    render_fill_rect( renderer, rect, color.r, color.g, color.b );
+}
+
 bool cata_tiles::draw_tile_at(
     const tile_type &tile, const point &p, unsigned int loc_rand, int rota,
     lit_level ll, bool apply_night_vision_goggles, int &height_3d )
@@ -2155,7 +2565,7 @@ bool cata_tiles::draw_terrain_below( const tripoint &p, const lit_level, int &,
     if( tile_iso ) {
         belowRect.y += tile_height / 8;
     }
-    render_fill_rect( renderer, belowRect, tercol.r, tercol.g, tercol.b );
+    render_rect( belowRect, tercol );
 
     return true;
 }
@@ -2194,6 +2604,11 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
         }
         // draw the actual terrain if there's no override
         if( !neighborhood_overridden ) {
+            if( const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().terrain,
+                                          t.to_i() ) ) {
+                return draw_resolved_tile( *rt, C_TERRAIN, p, subtile, rotation, ll,
+                                           nv_goggles_activated, height_3d );
+            }
             return draw_from_id_string( tname, C_TERRAIN, empty_string, p, subtile, rotation, ll,
                                         nv_goggles_activated, height_3d );
         }
@@ -2217,6 +2632,11 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? LL_LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
+            if( const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().terrain,
+                                          t2.to_i() ) ) {
+                return draw_resolved_tile( *rt, C_TERRAIN, p, subtile, rotation, lit, nv,
+                                           height_3d );
+            }
             return draw_from_id_string( tname, C_TERRAIN, empty_string, p, subtile, rotation, lit, nv,
                                         height_3d );
         }
@@ -2358,6 +2778,11 @@ bool cata_tiles::draw_furniture( const tripoint &p, const lit_level ll, int &hei
         }
         // draw the actual furniture if there's no override
         if( !neighborhood_overridden ) {
+            if( const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().furniture,
+                                          f.to_i() ) ) {
+                return draw_resolved_tile( *rt, C_FURNITURE, p, subtile, rotation, ll,
+                                           nv_goggles_activated, height_3d );
+            }
             return draw_from_id_string( fname, C_FURNITURE, empty_string, p, subtile, rotation, ll,
                                         nv_goggles_activated, height_3d );
         }
@@ -2387,6 +2812,11 @@ bool cata_tiles::draw_furniture( const tripoint &p, const lit_level ll, int &hei
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? LL_LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
+            if( const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().furniture,
+                                          f2.to_i() ) ) {
+                return draw_resolved_tile( *rt, C_FURNITURE, p, subtile, rotation, lit, nv,
+                                           height_3d );
+            }
             return draw_from_id_string( fname, C_FURNITURE, empty_string, p, subtile, rotation, lit, nv,
                                         height_3d );
         }
@@ -2515,8 +2945,15 @@ bool cata_tiles::draw_field_or_item( const tripoint &p, const lit_level ll, int
         int rotation = 0;
         get_tile_values( fld.to_i(), neighborhood, subtile, rotation );
 
-        ret_draw_field = draw_from_id_string( fld.id().str(), C_FIELD, empty_string, p, subtile,
-                                              rotation, lit, nv );
+        if( const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().fields,
+                                      fld.to_i() ) ) {
+            int nullint = 0;
+            ret_draw_field = draw_resolved_tile( *rt, C_FIELD, p, subtile, rotation, lit, nv,
+                                                 nullint );
+        } else {
+            ret_draw_field = draw_from_id_string( fld.id().str(), C_FIELD, empty_string, p, subtile,
+                                                  rotation, lit, nv );
+        }
     }
     if( fld.obj().display_items ) {
         const auto it_override = item_override.find( p );
@@ -2591,16 +3028,21 @@ bool cata_tiles::draw_vpart( const tripoint &p, lit_level ll, int &height_3d,
         const vpart_id &vp_id = veh.part_id_string( veh_part, part_mod );
         const int subtile = part_mod == 1 ? open_ : part_mod == 2 ? broken : 0;
         const int rotation = veh.face.dir();
-        const std::string vpname = "vp_" + vp_id.str();
         if( !veh.forward_velocity() && !veh.player_in_control( g->u ) &&
             g->m.check_seen_cache( p ) ) {
-            g->u.memorize_tile( g->m.getabs( p ), vpname, subtile, rotation );
+            g->u.memorize_tile( g->m.getabs( p ), "vp_" + vp_id.str(), subtile, rotation );
         }
         if( !overridden ) {
             const cata::optional<vpart_reference> cargopart = vp.part_with_feature( "CARGO", true );
             const bool draw_highlight = cargopart && !veh.get_items( cargopart->part_index() ).empty();
-            const bool ret = draw_from_id_string( vpname, C_VEHICLE_PART, empty_string, p, subtile, rotation,
-                                                  ll, nv_goggles_activated, height_3d );
+            const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().vehicle_parts,
+                                      &vp_id.obj() );
+            const bool ret = rt != nullptr ?
+                             draw_resolved_tile( *rt, C_VEHICLE_PART, p, subtile, rotation, ll,
+                                                 nv_goggles_activated, height_3d ) :
+                             draw_from_id_string( "vp_" + vp_id.str(), C_VEHICLE_PART, empty_string,
+                                                  p, subtile, rotation, ll, nv_goggles_activated,
+                                                  height_3d );
             if( ret && draw_highlight ) {
                 draw_item_highlight( p );
             }
@@ -2615,11 +3057,15 @@ bool cata_tiles::draw_vpart( const tripoint &p, lit_level ll, int &height_3d,
             const int subtile = part_mod == 1 ? open_ : part_mod == 2 ? broken : 0;
             const int rotation = std::get<2>( override->second );
             const int draw_highlight = std::get<3>( override->second );
-            const std::string vpname = "vp_" + vp2.str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
-            const bool ret = draw_from_id_string( vpname, C_VEHICLE_PART, empty_string, p, subtile, rotation,
-                                                  LL_LIT, false, height_3d );
+            const resolved_tile *rt = find_resolved_tile( current_resolved_tiles().vehicle_parts,
+                                      &vp2.obj() );
+            const bool ret = rt != nullptr ?
+                             draw_resolved_tile( *rt, C_VEHICLE_PART, p, subtile, rotation, LL_LIT,
+                                                 false, height_3d ) :
+                             draw_from_id_string( "vp_" + vp2.str(), C_VEHICLE_PART, empty_string,
+                                                  p, subtile, rotation, LL_LIT, false, height_3d );
             if( ret && draw_highlight ) {
                 draw_item_highlight( p );
             }
@@ -2683,7 +3129,7 @@ bool cata_tiles::draw_critter_at_below( const tripoint &p, const lit_level, int
         belowRect.y += tile_height / 8;
     }
 
-    render_fill_rect( renderer, belowRect, tercol.r, tercol.g, tercol.b );
+    render_rect( belowRect, tercol );
 
     return true;
 }
@@ -2730,10 +3176,6 @@ bool cata_tiles::draw_critter_at( const tripoint &p, lit_level ll, int &height_3
         const monster *m = dynamic_cast<const monster *>( &critter );
         if( m != nullptr ) {
             const auto ent_category = C_MONSTER;
-            std::string ent_subcategory = empty_string;
-            if( !m->type->species.empty() ) {
-                ent_subcategory = m->type->species.begin()->str();
-            }
             const int subtile = corner;
             // depending on the toggle flip sprite left or right
             int rot_facing = -1;
@@ -2742,10 +3184,23 @@ bool cata_tiles::draw_critter_at( const tripoint &p, lit_level ll, int &height_3
             } else if( m->facing == FD_LEFT ) {
                 rot_facing = 4;
             }
-            if( rot_facing >= 0 ) {
+            const bool ridden = rot_facing >= 0 && m->has_effect( effect_ridden );
+            // ridden monsters may have their own tiles, those are looked up by id
+            const resolved_tile *rt = ridden ? nullptr : find_resolved_tile(
+                                          current_resolved_tiles().monsters, m->type );
+            if( rt != nullptr && rot_facing >= 0 ) {
+                result = draw_resolved_tile( *rt, ent_category, p, subtile, rot_facing, ll, false,
+                                             height_3d );
+                sees_player = m->sees( g->u );
+                attitude = m->attitude_to( g-> u );
+            } else if( rot_facing >= 0 ) {
+                std::string ent_subcategory = empty_string;
+                if( !m->type->species.empty() ) {
+                    ent_subcategory = m->type->species.begin()->str();
+                }
                 const auto ent_name = m->type->id;
                 std::string chosen_id = ent_name.str();
-                if( m->has_effect( effect_ridden ) ) {
+                if( ridden ) {
                     int pl_under_height = 6;
                     if( m->mounted_player ) {
                         draw_entity_with_overlays( *m->mounted_player, p, ll, pl_under_height );
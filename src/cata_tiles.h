@@ -2,6 +2,7 @@
 #ifndef CATA_TILES_H
 #define CATA_TILES_H
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <map>
@@ -12,6 +13,7 @@
 
 #include "sdl_wrappers.h"
 #include "animation.h"
+#include "calendar.h"
 #include "creature.h"
 #include "lightmap.h"
 #include "line.h"
@@ -27,6 +29,8 @@ class Creature;
 class player;
 class pixel_minimap;
 class JsonObject;
+class vpart_info;
+struct mtype;
 
 using itype_id = std::string;
 
@@ -56,6 +60,36 @@ enum MULTITILE_TYPE {
     broken,
     num_multitile_types
 };
+
+/**
+ * The tile drawn for an id in one season, looked up through looks_like and the
+ * seasonal variants like @ref cata_tiles::find_tile_looks_like does.
+ */
+struct resolved_tile {
+    struct variant {
+        const tile_type *tt = nullptr;
+        // The id @ref tt was found under
+        std::string id;
+        // Furniture that can't be dragged around gets its sprite picked by its position
+        bool immovable_furniture = false;
+    };
+    variant tile;
+    // The tile for each multitile subtile (@ref MULTITILE_TYPE) that @ref tile has
+    std::array<variant, num_multitile_types> subtiles;
+    // False if the tileset has no tile for the id, it is drawn through its id string then
+    bool usable = false;
+};
+
+/** Tiles of the game objects that are drawn the most, resolved for one season. */
+struct resolved_tile_lookups {
+    // Indexed by the int ids
+    std::vector<resolved_tile> terrain;
+    std::vector<resolved_tile> furniture;
+    std::vector<resolved_tile> fields;
+    // These have no int ids
+    std::unordered_map<const mtype *, resolved_tile> monsters;
+    std::unordered_map<const vpart_info *, resolved_tile> vehicle_parts;
+};
 // Make sure to change TILE_CATEGORY_IDS if this changes!
 enum TILE_CATEGORY {
     C_NONE,
@@ -83,6 +117,14 @@ class texture
             srcrect( rect ) { }
         texture() = default;
 
+        /// The texture atlas (tile sheet) this is a part of.
+        SDL_Texture *atlas() const {
+            return sdl_texture_ptr.get();
+        }
+        /// Where in the @ref atlas this is.
+        const SDL_Rect &atlas_rect() const {
+            return srcrect;
+        }
         /// Returns the width (first) and height (second) of the stored texture.
         std::pair<int, int> dimension() const {
             return std::make_pair( srcrect.w, srcrect.h );
@@ -263,6 +305,89 @@ struct formatted_text {
  */
 using color_block_overlay_container = std::pair<SDL_BlendMode, std::multimap<point, SDL_Color>>;
 
+/**
+ * Keeps the map tiles of the last frame in a texture, so that only the parts of the
+ * screen that changed are drawn again.
+ * While recording, the sprites and rectangles of the map tiles are collected instead
+ * of rendered. The texture is split into chunks of tiles and a chunk is rendered again
+ * only if the drawing that covers it differs from the last frame, the other chunks are
+ * kept as they are. Finally the whole texture is copied to the screen.
+ */
+class retained_map_layer
+{
+    public:
+        /** A sprite, or a filled rectangle if @ref tex is null. */
+        struct draw_command {
+            const texture *tex;
+            SDL_Rect dest;
+            int angle;
+            SDL_RendererFlip flip;
+            SDL_Color color;
+        };
+
+        /**
+         * Starts recording a frame covering @p screen_area with tiles of @p tile_pixels
+         * pixels.
+         * @returns false if there is no texture to keep the frame in, the frame is
+         * then rendered directly to the screen when finished and the caller has to
+         * clear the area.
+         */
+        bool begin( const SDL_Renderer_Ptr &renderer, const SDL_Rect &screen_area,
+                    const point &tile_pixels );
+        /** Renders the chunks that changed and copies the frame to the screen. */
+        void finish( const SDL_Renderer_Ptr &renderer );
+        /** Forgets the last frame, for when the textures of the sprites are replaced. */
+        void invalidate();
+
+        bool is_recording() const {
+            return recording;
+        }
+        void record( const draw_command &cmd ) {
+            commands.push_back( cmd );
+        }
+
+    private:
+        struct batch_entry {
+            int layer;
+            SDL_Texture *atlas;
+            size_t command;
+        };
+
+        /**
+         * Renders the commands with the indices @p indices that touch @p bounds.
+         * Commands that overlap keep their order, the others are regrouped by atlas
+         * so that each atlas is bound as few times as possible, and sprites from
+         * the same atlas are submitted as one batch where SDL supports it.
+         * @param offset Added to the screen coordinates of the commands to get the
+         * coordinates on the current render target, which @p bounds is in.
+         */
+        void submit( const SDL_Renderer_Ptr &renderer, const std::vector<size_t> &indices,
+                     const SDL_Rect &bounds, const point &offset );
+        void render_command( const SDL_Renderer_Ptr &renderer, const draw_command &cmd,
+                             const point &offset ) const;
+        void flush_batch( const SDL_Renderer_Ptr &renderer );
+
+        SDL_Texture_Ptr target;
+        SDL_Rect area = { 0, 0, 0, 0 };
+        point tile_size;
+        point chunk_size;
+        point chunk_count;
+        bool recording = false;
+        std::vector<draw_command> commands;
+        // Indices into @ref commands of the drawing that covers each chunk
+        std::vector<std::vector<size_t>> chunk_commands;
+        // Hash of the drawing that covers each chunk in the frame kept in @ref target
+        std::vector<size_t> chunk_hashes;
+        // Scratch space of @ref submit, kept to avoid allocating for every chunk
+        std::vector<std::pair<int, SDL_Texture *>> cell_tops;
+        std::vector<batch_entry> batch_order;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        SDL_Texture *batch_atlas = nullptr;
+        std::vector<SDL_Vertex> batch_vertices;
+        std::vector<int> batch_indices;
+#endif
+};
+
 class cata_tiles
 {
     public:
@@ -289,7 +414,17 @@ class cata_tiles
         void get_window_tile_counts( int width, int height, int &columns, int &rows ) const;
 
         const tile_type *find_tile_with_season( std::string &id );
+        const tile_type *find_tile_with_season( std::string &id, season_type season ) const;
         const tile_type *find_tile_looks_like( std::string &id, TILE_CATEGORY category );
+        const tile_type *find_tile_looks_like( std::string &id, TILE_CATEGORY category,
+                                               season_type season ) const;
+        /** Builds @ref resolved_tiles for the current tileset and game data. */
+        void resolve_tiles();
+        resolved_tile resolve_tile( const std::string &id, TILE_CATEGORY category,
+                                    season_type season ) const;
+        resolved_tile::variant resolve_tile_variant( std::string id, TILE_CATEGORY category,
+                season_type season ) const;
+        const resolved_tile_lookups &current_resolved_tiles() const;
         bool find_overlay_looks_like( bool male, const std::string &overlay, std::string &draw_id );
 
         bool draw_from_id_string( std::string id, const tripoint &pos, int subtile, int rota, lit_level ll,
@@ -302,6 +437,15 @@ class cata_tiles
         bool draw_from_id_string( std::string id, TILE_CATEGORY category,
                                   const std::string &subcategory, const tripoint &pos, int subtile, int rota,
                                   lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        /** Like @ref draw_from_id_string, with the tile already looked up. */
+        bool draw_resolved_tile( const resolved_tile &rt, TILE_CATEGORY category,
+                                 const tripoint &pos, int subtile, int rota, lit_level ll,
+                                 bool apply_night_vision_goggles, int &height_3d );
+        /** Draws the tile found for @p id, after the multitile subtile has been picked. */
+        bool draw_tile_type_at( const tile_type &display_tile, const std::string &id,
+                                TILE_CATEGORY category, const tripoint &pos, int rota, lit_level ll,
+                                bool apply_night_vision_goggles, int &height_3d,
+                                bool immovable_furniture );
         bool draw_sprite_at(
             const tile_type &tile, const weighted_int_list<std::vector<int>> &svlist,
             const point &, unsigned int loc_rand, bool rota_fg, int rota, lit_level ll,
@@ -312,6 +456,11 @@ class cata_tiles
             bool apply_night_vision_goggles, int &height_3d );
         bool draw_tile_at( const tile_type &tile, const point &, unsigned int loc_rand, int rota,
                            lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        /** Renders a sprite, or records it while the map layer is recording. */
+        int render_sprite( const texture &tex, const SDL_Rect &dest, int angle,
+                           SDL_RendererFlip flip );
+        /** Fills a rectangle, or records it while the map layer is recording. */
+        void render_rect( const SDL_Rect &rect, const SDL_Color &color );
 
         /* Tile Picking */
         void get_tile_values( int t, const int *tn, int &subtile, int &rotation );
@@ -577,6 +726,10 @@ class cata_tiles
 
         pimpl<pixel_minimap> minimap;
 
+        retained_map_layer map_layer;
+
+        std::array<resolved_tile_lookups, NUM_SEASONS> resolved_tiles;
+
     public:
         std::string memory_map_mode = "color_pixel_sepia";
 };
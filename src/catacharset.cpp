@@ -142,12 +142,19 @@ std::string utf32_to_utf8( uint32_t ch )
 int utf8_width( const char *s, const bool ignore_tags )
 {
     if( ignore_tags ) {
-        return utf8_width( remove_color_tags( s ) );
+        return parse_color_tags( s )->width;
     }
     int len = strlen( s );
     const char *ptr = s;
     int w = 0;
     while( len > 0 ) {
+        // Printable ASCII is one cell wide, no need to decode it
+        if( *ptr >= 0x20 && *ptr < 0x7f ) {
+            ++w;
+            ++ptr;
+            --len;
+            continue;
+        }
         uint32_t ch = UTF8_getch( &ptr, &len );
         if( ch == UNKNOWN_UNICODE ) {
             continue;
@@ -85,6 +85,9 @@ void color_manager::finalize()
             }
         }
     }
+
+    // Color tags that were parsed before may name different colors now
+    clear_color_tag_cache();
 }
 
 nc_color color_manager::name_to_color( const std::string &name ) const
@@ -123,6 +123,11 @@ void erase();
 void endwin();
 void mvwaddch( const window &win, const point &p, chtype ch );
 void wclear( const window &win );
+/// Marks the whole window as changed, the next refresh copies all of it to the screen.
+void touchwin( const window &win );
+/// Number of changes made to the contents of the window. Nothing was written to the
+/// window between two calls that return the same number.
+int get_change_count( const window &win );
 void curs_set( int visibility );
 void wattron( const window &win, const nc_color &attrs );
 void wattroff( const window &win, int attrs );
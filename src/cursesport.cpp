@@ -3,6 +3,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "catacharset.h"
 #include "color.h"
@@ -23,10 +25,10 @@
  * and the actual text.
  * The text is split into lines (curseline), which contains cells (cursecell).
  * Each cell has individual foreground and background, and a character. The
- * character is an UTF-8 encoded string. It should be one or two console cells
- * width. If it's two cells width, the next cell in the line must be completely
- * empty (the string must not contain anything). Also the last cell of a line
- * must not contain a two cell width string.
+ * character is a glyph, a code point or an interned UTF-8 encoded string. It
+ * should be one or two console cells width. If it's two cells width, the next
+ * cell in the line must be completely empty (the empty glyph). Also the last
+ * cell of a line must not contain a two cell width glyph.
  */
 
 //***********************************
@@ -197,6 +199,66 @@ void catacurses::refresh()
     return wrefresh( stdscr );
 }
 
+namespace
+{
+struct interned_glyphs {
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> ids;
+};
+} // namespace
+
+static interned_glyphs &get_interned_glyphs()
+{
+    static interned_glyphs interned;
+    return interned;
+}
+
+cata_cursesport::glyph::glyph( const std::string &str )
+{
+    if( str.empty() ) {
+        return;
+    }
+    const char *ptr = str.c_str();
+    int len = str.length();
+    const uint32_t ch = UTF8_getch( &ptr, &len );
+    if( len == 0 && ch != UNKNOWN_UNICODE && ch != 0 && ch < interned_bit ) {
+        id = ch;
+        return;
+    }
+    interned_glyphs &interned = get_interned_glyphs();
+    const auto inserted = interned.ids.emplace( str, interned.strings.size() );
+    if( inserted.second ) {
+        interned.strings.push_back( str );
+    }
+    id = inserted.first->second | interned_bit;
+}
+
+uint32_t cata_cursesport::glyph::codepoint() const
+{
+    if( id & interned_bit ) {
+        return UTF8_getch( get_interned_glyphs().strings[id & ~interned_bit] );
+    }
+    return id;
+}
+
+std::string cata_cursesport::glyph::str() const
+{
+    if( id & interned_bit ) {
+        return get_interned_glyphs().strings[id & ~interned_bit];
+    } else if( id == 0 ) {
+        return std::string();
+    }
+    return utf32_to_utf8( id );
+}
+
+int cata_cursesport::glyph::width() const
+{
+    if( id & interned_bit ) {
+        return utf8_width( get_interned_glyphs().strings[id & ~interned_bit] );
+    }
+    return mk_wcwidth( id );
+}
+
 void catacurses::wredrawln( const window &/*win*/, int /*beg_line*/, int /*num_lines*/ )
 {
     /**
@@ -259,7 +321,9 @@ inline cata_cursesport::cursecell *cur_cell( cata_cursesport::WINDOW *win )
 inline void printstring( cata_cursesport::WINDOW *win, const std::string &text )
 {
     using cata_cursesport::cursecell;
+    using cata_cursesport::glyph;
     win->draw = true;
+    win->change_count++;
     int len = text.length();
     if( len == 0 ) {
         return;
@@ -277,8 +341,9 @@ inline void printstring( cata_cursesport::WINDOW *win, const std::string &text )
     }
     if( win->cursor.x > 0 && win->line[win->cursor.y].chars[win->cursor.x].ch.empty() ) {
         // start inside a wide character, erase it for good
-        win->line[win->cursor.y].chars[win->cursor.x - 1].ch.assign( " " );
+        win->line[win->cursor.y].chars[win->cursor.x - 1].ch = glyph( ' ' );
     }
+    std::string ch;
     while( len > 0 ) {
         if( *fmt == '\n' ) {
             if( newline( win ) == 0 ) {
@@ -292,7 +357,8 @@ inline void printstring( cata_cursesport::WINDOW *win, const std::string &text )
         if( curcell == nullptr ) {
             return;
         }
-        const int dlen = fill( fmt, len, curcell->ch );
+        const int dlen = fill( fmt, len, ch );
+        curcell->ch = glyph( ch );
         if( dlen >= 1 ) {
             curcell->FG = win->FG;
             curcell->BG = win->BG;
@@ -303,7 +369,7 @@ inline void printstring( cata_cursesport::WINDOW *win, const std::string &text )
             // following cell ~> clear it
             cursecell *seccell = cur_cell( win );
             if( seccell && seccell->ch.empty() ) {
-                seccell->ch.assign( ' ', 1 );
+                seccell->ch = glyph( ' ' );
             }
         } else if( dlen == 2 ) {
             // the second cell, per definition must be empty
@@ -312,12 +378,12 @@ inline void printstring( cata_cursesport::WINDOW *win, const std::string &text )
                 // the previous cell was valid, this one is outside of the window
                 // --> the previous was the last cell of the last line
                 // --> there should not be a two-cell width character in the last cell
-                curcell->ch.assign( ' ', 1 );
+                curcell->ch = glyph( ' ' );
                 return;
             }
             seccell->FG = win->FG;
             seccell->BG = win->BG;
-            seccell->ch.erase();
+            seccell->ch = glyph();
             addedchar( win );
             // Have just written a wide-character into the last cell, it would not
             // display correctly if it was the last *cell* of a line
@@ -325,12 +391,12 @@ inline void printstring( cata_cursesport::WINDOW *win, const std::string &text )
                 // So make that last cell a space, move the width
                 // character in the first cell of the line
                 seccell->ch = curcell->ch;
-                curcell->ch.assign( 1, ' ' );
+                curcell->ch = glyph( ' ' );
                 // and make the second cell on the new line empty.
                 addedchar( win );
                 cursecell *thicell = cur_cell( win );
                 if( thicell != nullptr ) {
-                    thicell->ch.erase();
+                    thicell->ch = glyph();
                 }
             }
         }
@@ -380,6 +446,7 @@ void catacurses::werase( const window &win_ )
         win->line[j].touched = true;
     }
     win->draw = true;
+    win->change_count++;
     wmove( win_, point_zero );
     //    wrefresh(win);
     handle_additional_window_clear( win );
@@ -408,6 +475,28 @@ void catacurses::wmove( const window &win_, const point &p )
     win->cursor = p;
 }
 
+//marks all lines of a window as changed
+void catacurses::touchwin( const window &win_ )
+{
+    cata_cursesport::WINDOW *const win = win_.get<cata_cursesport::WINDOW>();
+    if( win == nullptr ) {
+        // TODO: log this
+        return;
+    }
+
+    for( int j = 0; j < win->height; j++ ) {
+        win->line[j].touched = true;
+    }
+    win->draw = true;
+    handle_additional_window_clear( win );
+}
+
+int catacurses::get_change_count( const window &win_ )
+{
+    cata_cursesport::WINDOW *const win = win_.get<cata_cursesport::WINDOW>();
+    return win == nullptr ? 0 : win->change_count;
+}
+
 //Clears the main window     I'm not sure if its suppose to do this?
 void catacurses::clear()
 {
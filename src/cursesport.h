@@ -6,6 +6,7 @@
 #if defined(TILES) || defined(_WIN32)
 
 #include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -33,14 +34,54 @@ struct pairs {
     base_color BG;
 };
 
+/**
+ * The character in a cell. A single code point is stored as is, anything else (a code
+ * point followed by combining characters, or invalid UTF-8) is interned in a table
+ * that is never cleared, such strings are rare.
+ * The empty glyph is used for the second cell of a character that is two cells wide.
+ */
+class glyph
+{
+    public:
+        constexpr glyph() = default;
+        /** @param codepoint A valid Unicode code point. */
+        constexpr explicit glyph( const uint32_t codepoint ) : id( codepoint ) { }
+        explicit glyph( const std::string &str );
+
+        bool empty() const {
+            return id == 0;
+        }
+        /**
+         * The code point, or the first code point of an interned string.
+         * UNKNOWN_UNICODE if the string is not valid UTF-8.
+         */
+        uint32_t codepoint() const;
+        /** The glyph as UTF-8 string. */
+        std::string str() const;
+        /** Width in console cells, as returned by @ref utf8_width. */
+        int width() const;
+
+        bool operator==( const glyph &rhs ) const {
+            return id == rhs.id;
+        }
+        bool operator!=( const glyph &rhs ) const {
+            return id != rhs.id;
+        }
+
+    private:
+        // Set in the ids of interned strings, the other bits are the index into the table
+        static constexpr uint32_t interned_bit = 0x80000000;
+        uint32_t id = 0;
+};
+
 //Individual lines, so that we can track changed lines
 struct cursecell {
-    std::string ch;
+    glyph ch;
     base_color FG = static_cast<base_color>( 0 );
     base_color BG = static_cast<base_color>( 0 );
 
-    cursecell( std::string ch ) : ch( std::move( ch ) ) { }
-    cursecell() : cursecell( std::string( 1, ' ' ) ) { }
+    cursecell( const glyph &ch ) : ch( ch ) { }
+    cursecell() : cursecell( glyph( ' ' ) ) { }
 
     bool operator==( const cursecell &b ) const {
         return FG == b.FG && BG == b.BG && ch == b.ch;
@@ -66,6 +107,8 @@ struct WINDOW {
     bool inuse;
     // Tracks if the window text has been changed
     bool draw;
+    // Counts the changes of the window text, see catacurses::get_change_count
+    int change_count = 0;
     point cursor;
     std::vector<curseline> line;
 };
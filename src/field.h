@@ -84,7 +84,7 @@ class field_entry
         }
 
         //Returns true if this is an active field, false if it should be removed.
-        bool is_field_alive() {
+        bool is_field_alive() const {
             return is_alive;
         }
 
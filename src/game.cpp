@@ -1392,6 +1392,11 @@ bool game::do_turn()
         overmap_buffer.process_mongroups();
     }
 
+    // Prepare the overmap the player is heading to before they get there, a stage at a time
+    if( calendar::once_every( 10_turns ) ) {
+        overmap_buffer.pregenerate_near( u.global_omt_location() );
+    }
+
     // Move hordes every 2.5 min
     if( calendar::once_every( time_duration::from_minutes( 2.5 ) ) ) {
         overmap_buffer.move_hordes();
@@ -3106,8 +3111,13 @@ void game::draw()
     m.build_map_cache( ter_view_p.z );
     m.update_visibility_cache( ter_view_p.z );
 
-    werase( w_terrain );
+    if( is_draw_tiles_mode() ) {
+        werase( w_terrain );
+    }
+    // Otherwise the map writes every cell that changed, and only those, see map::draw
     draw_ter();
+    // Cells that were not written still have to be copied over what other windows left
+    catacurses::touchwin( w_terrain );
     wrefresh( w_terrain );
 
     draw_panels( true );
@@ -3241,16 +3251,25 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
     }
 
     m.draw( w_terrain, center );
+    // Cells drawn over the map, they have to be drawn again in the next frame
+    std::vector<point> overdrawn;
+    bool all_overdrawn = false;
+    const point center_cell = point( POSX, POSY ) - center.xy();
 
     if( draw_sounds ) {
         draw_footsteps( w_terrain, tripoint( -center.x, -center.y, center.z ) + point( POSX, POSY ) );
+        for( const tripoint &footstep : sounds::get_footstep_markers() ) {
+            overdrawn.push_back( footstep.xy() + center_cell );
+        }
     }
 
     for( Creature &critter : all_creatures() ) {
         draw_critter( critter, center );
+        overdrawn.push_back( critter.pos().xy() + center_cell );
     }
 
     if( u.has_active_bionic( bionic_id( "bio_scent_vision" ) ) && u.view_offset.z == 0 ) {
+        all_overdrawn = true;
         tripoint tmp = center;
         int &realx = tmp.x;
         int &realy = tmp.y;
@@ -3273,6 +3292,7 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
     }
 
     if( !destination_preview.empty() && u.view_offset.z == 0 ) {
+        all_overdrawn = true;
         // Draw auto-move preview trail
         const tripoint &final_destination = destination_preview.back();
         tripoint line_center = u.pos() + u.view_offset;
@@ -3282,9 +3302,13 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
     }
 
     if( u.controlling_vehicle && !looking ) {
+        all_overdrawn = true;
         draw_veh_dir_indicator( false );
         draw_veh_dir_indicator( true );
     }
+    if( !all_overdrawn ) {
+        m.drawn_over( w_terrain, overdrawn );
+    }
     // Place the cursor over the player as is expected by screen readers.
     wmove( w_terrain, -center.xy() + g->u.pos().xy() + point( POSX, POSY ) );
 }
@@ -7025,6 +7049,8 @@ void game::reset_item_list_state( const catacurses::window &window, int height,
 
 void game::list_items_monsters()
 {
+    // Items are listed by their names, which stay the same while the list is open
+    const item::name_cache_scope names;
     std::vector<Creature *> mons = u.get_visible_creatures( current_daylight_level( calendar::turn ) );
     // whole reality bubble
     const std::vector<map_item_stack> items = find_nearby_items( 60 );
@@ -410,9 +410,9 @@ size_t inventory_column::get_entry_cell_width( size_t index, size_t cell_index )
 }
 
 size_t inventory_column::get_entry_cell_width( const inventory_entry &entry,
-        size_t cell_index ) const
+        size_t cell_index, const std::string &text ) const
 {
-    size_t res = utf8_width( preset.get_cell_text( entry, cell_index ), true );
+    size_t res = utf8_width( text, true );
 
     if( cell_index == 0 ) {
         res += get_entry_indent( entry );
@@ -432,7 +432,7 @@ size_t inventory_column::get_cells_width() const
 void inventory_column::set_filter( const std::string &filter )
 {
     entries = entries_unfiltered;
-    entries_cell_cache.clear();
+    invalidate_cell_cache();
     paging_is_valid = false;
     prepare_paging( filter );
 }
@@ -527,12 +527,20 @@ void inventory_column::expand_to_fit( const inventory_entry &entry )
     }
 
     // Don't use cell cache here since the entry may not yet be placed into the vector of entries.
-    const std::string denial = preset.get_denial( entry );
+    expand_to_fit( entry, preset.get_denial( entry ), [&]( size_t cell_index ) {
+        return preset.get_cell_text( entry, cell_index );
+    } );
+    original_width_is_valid = false;
+}
 
+void inventory_column::expand_to_fit( const inventory_entry &entry, const std::string &denial,
+                                      const std::function<std::string( size_t )> &get_cell_text )
+{
     for( size_t i = 0, num = denial.empty() ? cells.size() : 1; i < num; ++i ) {
         auto &cell = cells[i];
 
-        cell.real_width = std::max( cell.real_width, get_entry_cell_width( entry, i ) );
+        cell.real_width = std::max( cell.real_width,
+                                    get_entry_cell_width( entry, i, get_cell_text( i ) ) );
 
         // Don't reveal the cell for headers and stubs
         if( cell.visible() || ( entry.is_item() && !preset.is_stub_cell( entry, i ) ) ) {
@@ -542,21 +550,42 @@ void inventory_column::expand_to_fit( const inventory_entry &entry )
     }
 
     if( !denial.empty() ) {
-        reserved_width = std::max( get_entry_cell_width( entry, 0 ) + min_denial_gap + utf8_width( denial,
-                                   true ),
+        reserved_width = std::max( get_entry_cell_width( entry, 0, get_cell_text( 0 ) ) +
+                                   min_denial_gap + utf8_width( denial, true ),
                                    reserved_width );
     }
 }
 
 void inventory_column::reset_width()
 {
+    if( original_width_is_valid ) {
+        cells = original_cells;
+        reserved_width = original_reserved_width;
+        return;
+    }
     for( auto &elem : cells ) {
         elem = cell_t();
     }
     reserved_width = 0;
-    for( auto &elem : entries ) {
-        expand_to_fit( elem );
+    // The layout is reset on every input, so the cells are built once and kept in the cache
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        if( !entries[i] ) {
+            continue;
+        }
+        const entry_cell_cache_t &cache = get_entry_cell_cache( i );
+        expand_to_fit( entries[i], cache.denial, [&cache]( size_t cell_index ) {
+            return cache.text[cell_index];
+        } );
     }
+    original_cells = cells;
+    original_reserved_width = reserved_width;
+    original_width_is_valid = true;
+}
+
+void inventory_column::invalidate_cell_cache()
+{
+    entries_cell_cache.clear();
+    original_width_is_valid = false;
 }
 
 size_t inventory_column::page_of( size_t index ) const
@@ -711,7 +740,7 @@ void inventory_column::add_entry( const inventory_entry &entry )
                                        && ( *cur_cat == *new_cat || *cur_cat < *new_cat ) );
     } );
     entries.insert( iter.base(), entry );
-    entries_cell_cache.clear();
+    invalidate_cell_cache();
     expand_to_fit( entry );
     paging_is_valid = false;
 }
@@ -749,6 +778,7 @@ void inventory_column::prepare_paging( const std::string &filter )
     // Then sort them with respect to categories
     auto from = entries.begin();
     while( from != entries.end() ) {
+        from->update_cache();
         auto to = std::next( from );
         while( to != entries.end() && from->get_category_ptr() == to->get_category_ptr() ) {
             to->update_cache();
@@ -792,7 +822,7 @@ void inventory_column::prepare_paging( const std::string &filter )
             }
         }
     }
-    entries_cell_cache.clear();
+    invalidate_cell_cache();
     paging_is_valid = true;
     if( entries_unfiltered.empty() ) {
         entries_unfiltered = entries;
@@ -804,7 +834,7 @@ void inventory_column::prepare_paging( const std::string &filter )
 void inventory_column::clear()
 {
     entries.clear();
-    entries_cell_cache.clear();
+    invalidate_cell_cache();
     paging_is_valid = false;
 }
 
@@ -1831,6 +1861,7 @@ const navigation_mode_data &inventory_selector::get_navigation_data( navigation_
 
 item_location inventory_pick_selector::execute()
 {
+    const item::name_cache_scope names;
     bool need_refresh = true;
     while( true ) {
         update( need_refresh );
@@ -1898,6 +1929,7 @@ inventory_compare_selector::inventory_compare_selector( player &p ) :
 
 std::pair<const item *, const item *> inventory_compare_selector::execute()
 {
+    const item::name_cache_scope names;
     bool need_refresh = true;
     while( true ) {
         update( need_refresh );
@@ -1975,6 +2007,7 @@ inventory_iuse_selector::inventory_iuse_selector(
 {}
 drop_locations inventory_iuse_selector::execute()
 {
+    const item::name_cache_scope names;
     int count = 0;
     bool need_refresh = true;
     while( true ) {
@@ -2097,6 +2130,7 @@ void inventory_drop_selector::process_selected( int &count,
 
 drop_locations inventory_drop_selector::execute()
 {
+    const item::name_cache_scope names;
     int count = 0;
     bool need_refresh = true;
     while( true ) {
@@ -294,7 +294,10 @@ class inventory_column
         size_t get_height() const;
         /** Expands the column to fit the new entry. */
         void expand_to_fit( const inventory_entry &entry );
-        /** Resets width to original (unchanged). */
+        /**
+         * Resets width to original (unchanged). The original widths are computed from the
+         * cached cells of the entries and kept until the entries change.
+         */
         void reset_width();
         /** Returns next custom inventory letter. */
         int reassign_custom_invlets( const player &p, int min_invlet, int max_invlet );
@@ -351,7 +354,8 @@ class inventory_column
          *  then a value returned by  inventory_column::get_entry_indent() is added to the result.
          */
         size_t get_entry_cell_width( size_t index, size_t cell_index ) const;
-        size_t get_entry_cell_width( const inventory_entry &entry, size_t cell_index ) const;
+        size_t get_entry_cell_width( const inventory_entry &entry, size_t cell_index,
+                                     const std::string &text ) const;
         /** Sum of the cell widths */
         size_t get_cells_width() const;
 
@@ -391,6 +395,16 @@ class inventory_column
         std::vector<cell_t> cells;
         mutable std::vector<entry_cell_cache_t> entries_cell_cache;
 
+        /** Cells and reserved width that fit all the entries, before set_width() changed them */
+        std::vector<cell_t> original_cells;
+        size_t original_reserved_width = 0;
+        bool original_width_is_valid = false;
+
+        /** Drops the cached cells and widths after the entries have changed. */
+        void invalidate_cell_cache();
+        void expand_to_fit( const inventory_entry &entry, const std::string &denial,
+                            const std::function<std::string( size_t )> &get_cell_text );
+
         /** @return Number of visible cells */
         size_t visible_cells() const;
 };
@@ -327,6 +327,134 @@ item::item( const recipe *rec, int qty, std::list<item> items, std::vector<item_
     }
 }
 
+/** Names of one item, remembered along with everything they are built from. */
+struct item::name_cache {
+    /** Which of the name functions was called and with what. */
+    struct key {
+        unsigned int quantity;
+        bool with_prefix;
+        unsigned int truncate;
+        bool display;
+
+        bool operator==( const key &rhs ) const {
+            return quantity == rhs.quantity && with_prefix == rhs.with_prefix &&
+                   truncate == rhs.truncate && display == rhs.display;
+        }
+    };
+    /** What is left of a contained item once it is folded into its container's name. */
+    struct content {
+        int generation;
+        const itype *type;
+        int charges;
+    };
+
+    int scope_generation;
+    // Public fields can be changed without going through @ref item::touch
+    int generation;
+    const itype *type;
+    int charges;
+    units::energy energy;
+    int burnt;
+    int item_counter;
+    bool active;
+    bool is_favorite;
+    size_t tags;
+    size_t faults;
+    std::vector<content> contents;
+
+    std::vector<std::pair<key, std::string>> names;
+
+    name_cache( const item &it, int scope_generation );
+    bool matches( const item &it, int scope_generation ) const;
+    const std::string *find( const key &k ) const;
+    void remember( const key &k, const std::string &name );
+};
+
+static constexpr size_t max_cached_names = 8;
+
+static int open_name_cache_scopes = 0;
+static int name_cache_scope_generation = 0;
+static int last_item_generation = 0;
+
+item::name_cache::name_cache( const item &it, const int scope_generation ) :
+    scope_generation( scope_generation ), generation( it.generation ), type( it.type ),
+    charges( it.charges ), energy( it.energy ), burnt( it.burnt ), item_counter( it.item_counter ),
+    active( it.active ), is_favorite( it.is_favorite ), tags( it.item_tags.size() ),
+    faults( it.faults.size() )
+{
+    contents.reserve( it.contents.size() );
+    for( const item &e : it.contents ) {
+        contents.push_back( { e.generation, e.type, e.charges } );
+    }
+}
+
+bool item::name_cache::matches( const item &it, const int scope_generation ) const
+{
+    if( this->scope_generation != scope_generation || generation != it.generation ||
+        type != it.type || charges != it.charges || energy != it.energy || burnt != it.burnt ||
+        item_counter != it.item_counter || active != it.active ||
+        is_favorite != it.is_favorite || tags != it.item_tags.size() ||
+        faults != it.faults.size() || contents.size() != it.contents.size() ) {
+        return false;
+    }
+    auto cached = contents.begin();
+    for( const item &e : it.contents ) {
+        if( cached->generation != e.generation || cached->type != e.type ||
+            cached->charges != e.charges ) {
+            return false;
+        }
+        ++cached;
+    }
+    return true;
+}
+
+const std::string *item::name_cache::find( const key &k ) const
+{
+    for( const auto &e : names ) {
+        if( e.first == k ) {
+            return &e.second;
+        }
+    }
+    return nullptr;
+}
+
+void item::name_cache::remember( const key &k, const std::string &name )
+{
+    if( names.size() >= max_cached_names ) {
+        names.erase( names.begin() );
+    }
+    names.emplace_back( k, name );
+}
+
+item::name_cache_scope::name_cache_scope()
+{
+    open_name_cache_scopes++;
+}
+
+item::name_cache_scope::~name_cache_scope()
+{
+    // The turn, the options or the player may change before the next scope is opened
+    if( --open_name_cache_scopes == 0 ) {
+        name_cache_scope_generation++;
+    }
+}
+
+void item::touch()
+{
+    generation = ++last_item_generation;
+}
+
+item::name_cache *item::get_name_cache() const
+{
+    if( open_name_cache_scopes == 0 ) {
+        return nullptr;
+    }
+    if( !name_cache_ || !name_cache_->matches( *this, name_cache_scope_generation ) ) {
+        name_cache_ = cata::make_value<name_cache>( *this, name_cache_scope_generation );
+    }
+    return name_cache_.get();
+}
+
 item::item( const item & ) = default;
 item::item( item && ) = default;
 item::~item() = default;
@@ -362,6 +490,7 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
 item &item::convert( const itype_id &new_type )
 {
     type = find_type( new_type );
+    touch();
     return *this;
 }
 
@@ -541,6 +670,7 @@ int item::damage_level( int max ) const
 item &item::set_damage( int qty )
 {
     damage_ = std::max( std::min( qty, max_damage() ), min_damage() );
+    touch();
     return *this;
 }
 
@@ -816,6 +946,7 @@ bool item::merge_charges( const item &rhs )
 void item::put_in( const item &payload )
 {
     contents.push_back( payload );
+    touch();
 }
 
 void item::set_var( const std::string &name, const int value )
@@ -824,6 +955,7 @@ void item::set_var( const std::string &name, const int value )
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
     item_vars[name] = tmpstream.str();
+    touch();
 }
 
 void item::set_var( const std::string &name, const long long value )
@@ -832,6 +964,7 @@ void item::set_var( const std::string &name, const long long value )
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
     item_vars[name] = tmpstream.str();
+    touch();
 }
 
 // NOLINTNEXTLINE(cata-no-long)
@@ -841,11 +974,13 @@ void item::set_var( const std::string &name, const long value )
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
     item_vars[name] = tmpstream.str();
+    touch();
 }
 
 void item::set_var( const std::string &name, const double value )
 {
     item_vars[name] = string_format( "%f", value );
+    touch();
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
@@ -860,6 +995,7 @@ double item::get_var( const std::string &name, const double default_value ) cons
 void item::set_var( const std::string &name, const tripoint &value )
 {
     item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    touch();
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
@@ -877,6 +1013,7 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
 void item::set_var( const std::string &name, const std::string &value )
 {
     item_vars[name] = value;
+    touch();
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
@@ -901,11 +1038,13 @@ bool item::has_var( const std::string &name ) const
 void item::erase_var( const std::string &name )
 {
     item_vars.erase( name );
+    touch();
 }
 
 void item::clear_vars()
 {
     item_vars.clear();
+    touch();
 }
 
 // TODO: Get rid of, handle multiple types gracefully
@@ -3828,6 +3967,22 @@ void item::on_damage( int, damage_type )
 }
 
 std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int truncate ) const
+{
+    name_cache *const cache = get_name_cache();
+    if( cache == nullptr ) {
+        return tname_uncached( quantity, with_prefix, truncate );
+    }
+    const name_cache::key k{ quantity, with_prefix, truncate, false };
+    if( const std::string *name = cache->find( k ) ) {
+        return *name;
+    }
+    const std::string name = tname_uncached( quantity, with_prefix, truncate );
+    cache->remember( k, name );
+    return name;
+}
+
+std::string item::tname_uncached( unsigned int quantity, bool with_prefix,
+                                  unsigned int truncate ) const
 {
     int dirt_level = get_var( "dirt", 0 ) / 2000;
     std::string dirt_symbol;
@@ -4101,6 +4256,21 @@ std::string item::display_money( unsigned int quantity, unsigned int total,
 }
 
 std::string item::display_name( unsigned int quantity ) const
+{
+    name_cache *const cache = get_name_cache();
+    if( cache == nullptr ) {
+        return display_name_uncached( quantity );
+    }
+    const name_cache::key k{ quantity, true, 0, true };
+    if( const std::string *name = cache->find( k ) ) {
+        return *name;
+    }
+    const std::string name = display_name_uncached( quantity );
+    cache->remember( k, name );
+    return name;
+}
+
+std::string item::display_name_uncached( unsigned int quantity ) const
 {
     std::string name = tname( quantity );
     std::string sidetxt;
@@ -4573,6 +4743,7 @@ int item::reach_range( const player &p ) const
 void item::unset_flags()
 {
     item_tags.clear();
+    touch();
 }
 
 bool item::has_fault( const fault_id &fault ) const
@@ -4618,12 +4789,14 @@ bool item::has_any_flag( const std::vector<std::string> &flags ) const
 item &item::set_flag( const std::string &flag )
 {
     item_tags.insert( flag );
+    touch();
     return *this;
 }
 
 item &item::unset_flag( const std::string &flag )
 {
     item_tags.erase( flag );
+    touch();
     return *this;
 }
 
@@ -4819,12 +4992,14 @@ void item::set_relative_rot( double val )
         if( !has_flag( flag_PROCESSING_RESULT ) ) {
             last_rot_check = calendar::turn;
         }
+        touch();
     }
 }
 
 void item::set_rot( time_duration val )
 {
     rot = val;
+    touch();
 }
 
 int item::spoilage_sort_order()
@@ -4964,6 +5139,7 @@ void item::calc_rot( time_point time, int temp )
     time_duration time_delta = time - last_rot_check;
     rot += factor * time_delta / 1_hours * get_hourly_rotpoints_at_temp( temp ) * 1_turns;
     last_rot_check = time;
+    touch();
 }
 
 void item::calc_rot_while_processing( time_duration processing_duration )
@@ -5466,6 +5642,7 @@ bool item::mod_damage( int qty, damage_type dt )
 
         damage_ = std::max( std::min( damage_ + qty, max_damage() ), min_damage() );
     }
+    touch();
 
     return destroy;
 }
@@ -5928,6 +6105,7 @@ void item::set_mtype( const mtype *const m )
         return;
     }
     corpse = m;
+    touch();
 }
 
 bool item::is_ammo_container() const
@@ -7939,6 +8117,7 @@ void item::set_item_temperature( float new_temperature )
         item_tags.insert( "COLD" );
     }
     reset_temp_check();
+    touch();
 }
 
 void item::fill_with( item &liquid, int amount )
@@ -9577,6 +9756,7 @@ std::vector<item_comp> item::get_uncraft_components() const
 void item::set_favorite( const bool favorite )
 {
     is_favorite = favorite;
+    touch();
 }
 
 const recipe &item::get_making() const
@@ -328,6 +328,20 @@ class item : public visitable<item>
          */
         std::string tname( unsigned int quantity = 1, bool with_prefix = true,
                            unsigned int truncate = 0 ) const;
+        /**
+         * While at least one of these is alive, @ref tname and @ref display_name remember
+         * the names they build on each item and return them again until the item changes.
+         * Open one around a menu, a listing or a sort: the current turn, the options and
+         * the player's skills are assumed to stay the same for as long as it is open.
+         */
+        class name_cache_scope
+        {
+            public:
+                name_cache_scope();
+                ~name_cache_scope();
+                name_cache_scope( const name_cache_scope & ) = delete;
+                name_cache_scope &operator=( const name_cache_scope & ) = delete;
+        };
         std::string display_money( unsigned int quantity, unsigned int total,
                                    const cata::optional<unsigned int> &selected = cata::nullopt ) const;
         /**
@@ -2191,6 +2205,22 @@ class item : public visitable<item>
         int damage_ = 0;
         light_emission light = nolight;
 
+        /**
+         * Changed by @ref touch whenever the item is modified through one of its setters.
+         * Not serialized, only names remembered inside a @ref name_cache_scope use it.
+         */
+        int generation = 0;
+        struct name_cache;
+        mutable cata::value_ptr<name_cache> name_cache_;
+
+        /** Gives the item a new @ref generation, so names remembered for it are built again. */
+        void touch();
+        /** Names remembered for the current state of the item, nullptr outside of any scope. */
+        name_cache *get_name_cache() const;
+        std::string tname_uncached( unsigned int quantity, bool with_prefix,
+                                    unsigned int truncate ) const;
+        std::string display_name_uncached( unsigned int quantity ) const;
+
     public:
         char invlet = 0;      // Inventory letter
         bool active = false; // If true, it has active effects to be processed
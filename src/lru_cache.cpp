@@ -1,17 +1,41 @@
 #include "lru_cache.h"
 
+#include <algorithm>
 #include <cstddef>
-#include <iterator>
+#include <functional>
 
-#include "map_memory.h"
 #include "point.h"
 
+template<typename Key, typename Value>
+constexpr std::int32_t lru_cache<Key, Value>::none;
+
+template<typename Key, typename Value>
+size_t lru_cache<Key, Value>::bucket( const Key &pos ) const
+{
+    // The coordinate hashes are linear in x, so a row of the map being drawn or
+    // memorized walks the bucket table in order instead of jumping around.
+    return std::hash<Key>()( pos ) & ( buckets.size() - 1 );
+}
+
+template<typename Key, typename Value>
+std::int32_t lru_cache<Key, Value>::find( const Key &pos ) const
+{
+    if( count == 0 ) {
+        return none;
+    }
+    std::int32_t index = buckets[bucket( pos )];
+    while( index != none && !( nodes[index].entry.first == pos ) ) {
+        index = nodes[index].chained;
+    }
+    return index;
+}
+
 template<typename Key, typename Value>
 Value lru_cache<Key, Value>::get( const Key &pos, const Value &default_ ) const
 {
-    auto found = map.find( pos );
-    if( found != map.end() ) {
-        return found->second->second;
+    const std::int32_t found = find( pos );
+    if( found != none ) {
+        return nodes[found].entry.second;
     }
     return default_;
 }
@@ -19,56 +43,140 @@ Value lru_cache<Key, Value>::get( const Key &pos, const Value &default_ ) const
 template<typename Key, typename Value>
 void lru_cache<Key, Value>::remove( const Key &pos )
 {
-    auto found = map.find( pos );
-    if( found != map.end() ) {
-        ordered_list.erase( found->second );
-        map.erase( found );
+    const std::int32_t found = find( pos );
+    if( found != none ) {
+        erase( found );
     }
 }
 
 template<typename Key, typename Value>
 void lru_cache<Key, Value>::insert( int limit, const Key &pos, const Value &t )
 {
-    auto found = map.find( pos );
+    const std::int32_t found = find( pos );
 
-    if( found == map.end() ) {
-        // Need new entry in map.  Make the new list entry and point to it.
-        ordered_list.emplace_back( pos, t );
-        map[pos] = std::prev( ordered_list.end() );
+    if( found == none ) {
+        if( count + 1 > buckets.size() ) {
+            grow();
+        }
+        // Reuse a dropped entry if there is one, the array only grows up to the limit.
+        std::int32_t index;
+        if( !free_nodes.empty() ) {
+            index = free_nodes.back();
+            free_nodes.pop_back();
+            nodes[index].entry = Pair( pos, t );
+        } else {
+            index = static_cast<std::int32_t>( nodes.size() );
+            nodes.push_back( node{ Pair( pos, t ), none, none, none } );
+        }
+        std::int32_t &head = buckets[bucket( pos )];
+        nodes[index].chained = head;
+        head = index;
+        link_back( index );
+        ++count;
         trim( limit );
     } else {
-        // Splice existing entry to the back.  Does not invalidate the
-        // iterator, so no need to change the map.
-        auto list_iterator = found->second;
-        ordered_list.splice( ordered_list.end(), ordered_list, list_iterator );
-        // Update the moved item
-        list_iterator->second = t;
+        // Move existing entry to the back and update it.
+        unlink( found );
+        link_back( found );
+        nodes[found].entry.second = t;
     }
 }
 
 template<typename Key, typename Value>
 void lru_cache<Key, Value>::trim( int limit )
 {
-    while( map.size() > static_cast<size_t>( limit ) ) {
-        map.erase( ordered_list.front().first );
-        ordered_list.pop_front();
+    while( count > static_cast<size_t>( std::max( limit, 0 ) ) ) {
+        erase( oldest );
+    }
+}
+
+template<typename Key, typename Value>
+void lru_cache<Key, Value>::erase( std::int32_t index )
+{
+    std::int32_t *link = &buckets[bucket( nodes[index].entry.first )];
+    while( *link != index ) {
+        link = &nodes[*link].chained;
+    }
+    *link = nodes[index].chained;
+    unlink( index );
+    // Don't keep the value alive, it may own memory.
+    nodes[index].entry = Pair();
+    free_nodes.push_back( index );
+    --count;
+}
+
+template<typename Key, typename Value>
+void lru_cache<Key, Value>::grow()
+{
+    buckets.assign( std::max<size_t>( buckets.size() * 2, 16 ), none );
+    for( std::int32_t index = oldest; index != none; index = nodes[index].next ) {
+        std::int32_t &head = buckets[bucket( nodes[index].entry.first )];
+        nodes[index].chained = head;
+        head = index;
     }
 }
 
+template<typename Key, typename Value>
+void lru_cache<Key, Value>::unlink( std::int32_t index )
+{
+    node &n = nodes[index];
+    if( n.prev != none ) {
+        nodes[n.prev].next = n.next;
+    } else {
+        oldest = n.next;
+    }
+    if( n.next != none ) {
+        nodes[n.next].prev = n.prev;
+    } else {
+        newest = n.prev;
+    }
+    n.prev = none;
+    n.next = none;
+}
+
+template<typename Key, typename Value>
+void lru_cache<Key, Value>::link_back( std::int32_t index )
+{
+    nodes[index].prev = newest;
+    nodes[index].next = none;
+    if( newest != none ) {
+        nodes[newest].next = index;
+    } else {
+        oldest = index;
+    }
+    newest = index;
+}
+
 template<typename Key, typename Value>
 void lru_cache<Key, Value>::clear()
 {
-    map.clear();
-    ordered_list.clear();
+    // Keep the capacity, caches are usually refilled right away.
+    nodes.clear();
+    free_nodes.clear();
+    std::fill( buckets.begin(), buckets.end(), none );
+    oldest = none;
+    newest = none;
+    count = 0;
+}
+
+template<typename Key, typename Value>
+size_t lru_cache<Key, Value>::size() const
+{
+    return count;
+}
+
+template<typename Key, typename Value>
+typename lru_cache<Key, Value>::const_iterator lru_cache<Key, Value>::begin() const
+{
+    return const_iterator( nodes, oldest );
 }
 
 template<typename Key, typename Value>
-const std::list<typename lru_cache<Key, Value>::Pair> &lru_cache<Key, Value>::list() const
+typename lru_cache<Key, Value>::const_iterator lru_cache<Key, Value>::end() const
 {
-    return ordered_list;
+    return const_iterator( nodes, none );
 }
 
 // explicit template initialization for lru_cache of all types
-template class lru_cache<tripoint, memorized_terrain_tile>;
 template class lru_cache<tripoint, int>;
 template class lru_cache<point, char>;
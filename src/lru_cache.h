@@ -2,28 +2,99 @@
 #ifndef LRU_CACHE_H
 #define LRU_CACHE_H
 
-#include <list>
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <utility>
+#include <vector>
 
 #include "enums.h" // IWYU pragma: keep
 
+/**
+ * Map of a limited size that drops the least recently inserted entries first.
+ *
+ * Entries live in a flat array, linked by index in the order of insertion and in
+ * the chains of a bucket table. Inserting or removing an entry does not allocate
+ * once the containers have grown to the size of the cache.
+ */
 template<typename Key, typename Value>
 class lru_cache
 {
     public:
         using Pair = std::pair<Key, Value>;
 
+    private:
+        struct node {
+            Pair entry;
+            // Indices of the neighbouring entries in the insertion order
+            std::int32_t prev;
+            std::int32_t next;
+            // Index of the next entry in the same bucket
+            std::int32_t chained;
+        };
+        static constexpr std::int32_t none = -1;
+
+    public:
+        /** Iterates over the entries from the least to the most recently inserted. */
+        class const_iterator
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Pair;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Pair *;
+                using reference = const Pair &;
+
+                const_iterator( const std::vector<node> &nodes, std::int32_t index ) :
+                    nodes( &nodes ), index( index ) {}
+
+                reference operator*() const {
+                    return ( *nodes )[index].entry;
+                }
+                pointer operator->() const {
+                    return &( *nodes )[index].entry;
+                }
+                const_iterator &operator++() {
+                    index = ( *nodes )[index].next;
+                    return *this;
+                }
+                bool operator==( const const_iterator &rhs ) const {
+                    return index == rhs.index;
+                }
+                bool operator!=( const const_iterator &rhs ) const {
+                    return index != rhs.index;
+                }
+            private:
+                const std::vector<node> *nodes;
+                std::int32_t index;
+        };
+
         void insert( int limit, const Key &, const Value & );
         Value get( const Key &, const Value &default_ ) const;
         void remove( const Key & );
 
         void clear();
-        const std::list<Pair> &list() const;
+        size_t size() const;
+        const_iterator begin() const;
+        const_iterator end() const;
     private:
         void trim( int limit );
-        std::list<Pair> ordered_list;
-        std::unordered_map<Key, typename std::list<Pair>::iterator> map;
+        size_t bucket( const Key & ) const;
+        /** Index of the entry with the given key, or none. */
+        std::int32_t find( const Key & ) const;
+        void erase( std::int32_t index );
+        void grow();
+        void unlink( std::int32_t index );
+        void link_back( std::int32_t index );
+
+        std::vector<node> nodes;
+        // Indices of unused entries in @ref nodes
+        std::vector<std::int32_t> free_nodes;
+        // First entry of each bucket, the table size is a power of two
+        std::vector<std::int32_t> buckets;
+        std::int32_t oldest = none;
+        std::int32_t newest = none;
+        size_t count = 0;
 };
 
 #endif
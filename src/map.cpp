@@ -146,6 +146,9 @@ map::~map() = default;
 
 static submap null_submap;
 
+int map::terrain_generation = 0;
+int map::field_generation = 0;
+
 maptile map::maptile_at( const tripoint &p ) const
 {
     if( !inbounds( p ) ) {
@@ -1118,6 +1121,7 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp )
     }
     veh.pivot_anchor[0] = veh.pivot_anchor[1];
     veh.pivot_rotation[0] = veh.pivot_rotation[1];
+    veh.precalc_bounds[0] = veh.precalc_bounds[1];
 
     veh.pos = dst_offset;
     veh.sm_pos.z = p2.z;
@@ -1251,6 +1255,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture )
     }
 
     current_submap->set_furn( l, new_furniture );
+    terrain_generation++;
 
     // Set the dirty flags
     const furn_t &old_t = old_id.obj();
@@ -1499,6 +1504,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     }
 
     current_submap->set_ter( l, new_terrain );
+    terrain_generation++;
 
     // Set the dirty flags
     const ter_t &old_t = old_id.obj();
@@ -1541,6 +1547,11 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     return true;
 }
 
+int map::get_terrain_stamp( const tripoint &gridp ) const
+{
+    return get_submap_at_grid( gridp )->get_terrain_stamp();
+}
+
 std::string map::tername( const tripoint &p ) const
 {
     return ter( p ).obj().name();
@@ -2518,6 +2529,9 @@ void map::decay_fields_and_scent( const time_duration &amount )
                 }
 
                 for( int sy = 0; sy < SEEY; ++sy ) {
+                    if( !cur_submap->field_tiles[submap::field_tile_index( { sx, sy } )] ) {
+                        continue;
+                    }
                     const int x = sx + smx * SEEX;
                     const int y = sy + smy * SEEY;
 
@@ -5217,6 +5231,33 @@ field_entry *map::get_field( const tripoint &p, const field_type_id &type )
     return current_submap->get_field( l ).find_field( type );
 }
 
+std::vector<tripoint> map::get_field_locations( const field_type_id &type, const int zlev )
+{
+    std::vector<tripoint> ret;
+    if( !inbounds_z( zlev ) ) {
+        return ret;
+    }
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            submap *const cur_submap = get_submap_at_grid( { smx, smy, zlev } );
+            if( cur_submap == nullptr || cur_submap->field_count < 1 ) {
+                continue;
+            }
+            for( int sx = 0; sx < SEEX; ++sx ) {
+                for( int sy = 0; sy < SEEY; ++sy ) {
+                    if( !cur_submap->field_tiles[submap::field_tile_index( { sx, sy } )] ) {
+                        continue;
+                    }
+                    if( cur_submap->get_field( { sx, sy } ).find_field( type ) != nullptr ) {
+                        ret.emplace_back( sx + smx * SEEX, sy + smy * SEEY, zlev );
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool map::dangerous_field_at( const tripoint &p )
 {
     for( auto &pr : field_at( p ) ) {
@@ -5252,6 +5293,8 @@ bool map::add_field( const tripoint &p, const field_type_id &type, int intensity
     current_submap->is_uniform = false;
 
     if( current_submap->get_field( l ).add_field( type, intensity, age ) ) {
+        current_submap->mark_field_tile( l );
+        field_generation++;
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -5405,8 +5448,11 @@ void map::update_visibility_cache( const int zlev )
 
     int sm_squares_seen[MAPSIZE][MAPSIZE];
     std::memset( sm_squares_seen, 0, sizeof( sm_squares_seen ) );
+    bool sm_changed[MAPSIZE][MAPSIZE];
+    std::memset( sm_changed, 0, sizeof( sm_changed ) );
 
-    auto &visibility_cache = get_cache( zlev ).visibility_cache;
+    level_cache &map_cache = get_cache( zlev );
+    auto &visibility_cache = map_cache.visibility_cache;
 
     tripoint p;
     p.z = zlev;
@@ -5415,11 +5461,23 @@ void map::update_visibility_cache( const int zlev )
     for( x = 0; x < MAPSIZE_X; x++ ) {
         for( y = 0; y < MAPSIZE_Y; y++ ) {
             lit_level ll = apparent_light_at( p, visibility_variables_cache );
-            visibility_cache[x][y] = ll;
+            if( visibility_cache[x][y] != ll ) {
+                visibility_cache[x][y] = ll;
+                sm_changed[ x / SEEX ][ y / SEEY ] = true;
+            }
             sm_squares_seen[ x / SEEX ][ y / SEEY ] += ( ll == LL_BRIGHT || ll == LL_LIT );
         }
     }
 
+    static int last_visibility_stamp = 0;
+    for( int gridx = 0; gridx < MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < MAPSIZE; gridy++ ) {
+            if( sm_changed[gridx][gridy] ) {
+                map_cache.visibility_stamps[gridx][gridy] = ++last_visibility_stamp;
+            }
+        }
+    }
+
     for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
         for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
             if( sm_squares_seen[gridx][gridy] > 36 ) { // 25% of the submap is visible
@@ -5469,10 +5527,12 @@ visibility_type map::get_visibility( const lit_level ll, const visibility_variab
     return VIS_HIDDEN;
 }
 
-bool map::apply_vision_effects( const catacurses::window &w, const visibility_type vis ) const
+// Symbol and color shown instead of a tile that can't be seen clearly,
+// returns false if the tile can be seen.
+static bool get_vision_effect( const visibility_type vis, int &symbol, nc_color &color )
 {
-    int symbol = ' ';
-    nc_color color = c_black;
+    symbol = ' ';
+    color = c_black;
 
     switch( vis ) {
         case VIS_CLEAR:
@@ -5498,6 +5558,16 @@ bool map::apply_vision_effects( const catacurses::window &w, const visibility_ty
             color = c_black;
             break;
     }
+    return true;
+}
+
+bool map::apply_vision_effects( const catacurses::window &w, const visibility_type vis ) const
+{
+    int symbol = ' ';
+    nc_color color = c_black;
+    if( !get_vision_effect( vis, symbol, color ) ) {
+        return false;
+    }
     wputch( w, color, symbol );
     return true;
 }
@@ -5509,15 +5579,41 @@ bool map::draw_maptile_from_memory( const catacurses::window &w, const tripoint
     if( sym == 0 ) {
         return false;
     }
-    if( move_cursor ) {
-        const int k = p.x + getmaxx( w ) / 2 - view_center.x;
-        const int j = p.y + getmaxy( w ) / 2 - view_center.y;
+    const int k = p.x + getmaxx( w ) / 2 - view_center.x;
+    const int j = p.y + getmaxy( w ) / 2 - view_center.y;
+    draw_cell( w, point( k, j ), c_brown, sym, std::string(), !move_cursor );
+    return true;
+}
 
-        mvwputch( w, point( k, j ), c_brown, sym );
+void map::draw_cell( const catacurses::window &w, const point &cell, const nc_color &color,
+                     const int sym, const std::string &str, const bool inorder ) const
+{
+    if( drawing_cells ) {
+        if( cell.x < 0 || cell.y < 0 || cell.x >= drawn_size.x || cell.y >= drawn_size.y ) {
+            return;
+        }
+        drawn_cell &drawn = drawn_cells[cell.x + cell.y * drawn_size.x];
+        if( drawn.sym == sym && drawn.color == color && drawn.str == str ) {
+            return;
+        }
+        drawn.sym = sym;
+        drawn.str = str;
+        drawn.color = color;
+        cells_drawn++;
+    } else if( inorder ) {
+        // Rastering the whole map, take advantage of automatically moving the cursor.
+        if( str.empty() ) {
+            wputch( w, color, sym );
+        } else {
+            wprintz( w, color, str );
+        }
+        return;
+    }
+    if( str.empty() ) {
+        mvwputch( w, cell, color, sym );
     } else {
-        wputch( w, c_brown, sym );
+        mvwprintz( w, cell, color, str );
     }
-    return true;
 }
 
 void map::draw( const catacurses::window &w, const tripoint &center )
@@ -5534,35 +5630,52 @@ void map::draw( const catacurses::window &w, const tripoint &center )
 
     const auto &visibility_cache = get_cache_ref( center.z ).visibility_cache;
 
+    // The cells drawn the last time can be kept if nothing else was written to the window since
+    const point window_size( getmaxx( w ), getmaxy( w ) );
+    if( drawn_window.lock() != w.weak_ptr().lock() || drawn_size != window_size ||
+        drawn_change_count != catacurses::get_change_count( w ) ) {
+        drawn_window = w.weak_ptr();
+        drawn_size = window_size;
+        drawn_cells.assign( window_size.x * window_size.y, drawn_cell() );
+    }
+    cells_drawn = 0;
+    drawing_cells = true;
+
     // X and y are in map coordinates, but might be out of range of the map.
     // When they are out of range, we just draw '#'s.
     tripoint p;
     p.z = center.z;
     int &x = p.x;
     int &y = p.y;
+    const point offset = window_size / 2 - center.xy();
     const bool do_map_memory = g->u.should_show_map_memory();
+    // Draws the vision effect, or what is remembered of a tile that can't be seen
+    const auto draw_unseen = [&]( const visibility_type vis ) {
+        if( do_map_memory && ( vis == VIS_HIDDEN || vis == VIS_DARK ) &&
+            draw_maptile_from_memory( w, p, center ) ) {
+            return;
+        }
+        int symbol = ' ';
+        nc_color color = c_black;
+        get_vision_effect( vis, symbol, color );
+        draw_cell( w, p.xy() + offset, color, symbol, std::string(), false );
+    };
     for( y = center.y - getmaxy( w ) / 2; y <= center.y + getmaxy( w ) / 2; y++ ) {
         if( y - center.y + getmaxy( w ) / 2 >= getmaxy( w ) ) {
             continue;
         }
 
-        wmove( w, point( 0, y - center.y + getmaxy( w ) / 2 ) );
-
         const int maxxrender = center.x - getmaxx( w ) / 2 + getmaxx( w );
         x = center.x - getmaxx( w ) / 2;
         if( y < 0 || y >= MAPSIZE_Y ) {
             for( ; x < maxxrender; x++ ) {
-                if( !do_map_memory || !draw_maptile_from_memory( w, p, center, false ) ) {
-                    wputch( w, c_black, ' ' );
-                }
+                draw_unseen( VIS_HIDDEN );
             }
             continue;
         }
 
         while( x < 0 ) {
-            if( !do_map_memory || !draw_maptile_from_memory( w, p, center, false ) ) {
-                wputch( w, c_black, ' ' );
-            }
+            draw_unseen( VIS_HIDDEN );
             x++;
         }
 
@@ -5575,12 +5688,12 @@ void map::draw( const catacurses::window &w, const tripoint &center )
             while( l.x < SEEX && x < maxx )  {
                 const lit_level lighting = visibility_cache[x][y];
                 const visibility_type vis = get_visibility( lighting, cache );
-                if( !apply_vision_effects( w, vis ) ) {
+                if( vis == VIS_CLEAR ) {
                     const maptile curr_maptile = maptile( cur_submap, l );
                     const bool just_this_zlevel =
                         draw_maptile( w, g->u, p, curr_maptile,
                                       false, true, center,
-                                      lighting == LL_LOW, lighting == LL_BRIGHT, true );
+                                      lighting == LL_LOW, lighting == LL_BRIGHT, false );
                     if( !just_this_zlevel ) {
                         p.z--;
                         const maptile tile_below = maptile( sm_below, l );
@@ -5588,8 +5701,8 @@ void map::draw( const catacurses::window &w, const tripoint &center )
                                          lighting == LL_LOW, lighting == LL_BRIGHT, false );
                         p.z++;
                     }
-                } else if( do_map_memory && ( vis == VIS_HIDDEN || vis == VIS_DARK ) ) {
-                    draw_maptile_from_memory( w, p, center );
+                } else {
+                    draw_unseen( vis );
                 }
 
                 l.x++;
@@ -5598,12 +5711,27 @@ void map::draw( const catacurses::window &w, const tripoint &center )
         }
 
         while( x < maxxrender ) {
-            if( !do_map_memory || !draw_maptile_from_memory( w, p, center, false ) ) {
-                wputch( w, c_black, ' ' );
-            }
+            draw_unseen( VIS_HIDDEN );
             x++;
         }
     }
+
+    drawing_cells = false;
+    drawn_change_count = catacurses::get_change_count( w );
+}
+
+void map::drawn_over( const catacurses::window &w, const std::vector<point> &cells )
+{
+    // In tiles mode draw() leaves the window alone
+    if( is_draw_tiles_mode() || drawn_window.lock() != w.weak_ptr().lock() ) {
+        return;
+    }
+    for( const point &cell : cells ) {
+        if( cell.x >= 0 && cell.y >= 0 && cell.x < drawn_size.x && cell.y < drawn_size.y ) {
+            drawn_cells[cell.x + cell.y * drawn_size.x] = drawn_cell();
+        }
+    }
+    drawn_change_count = catacurses::get_change_count( w );
 }
 
 void map::drawsq( const catacurses::window &w, player &u, const tripoint &p,
@@ -5818,23 +5946,9 @@ bool map::draw_maptile( const catacurses::window &w, const player &u, const trip
         tercol = red_background( tercol );
     }
 
-    if( inorder ) {
-        // Rastering the whole map, take advantage of automatically moving the cursor.
-        if( item_sym.empty() ) {
-            wputch( w, tercol, sym );
-        } else {
-            wprintz( w, tercol, item_sym );
-        }
-    } else {
-        // Otherwise move the cursor before drawing.
-        const int k = p.x + getmaxx( w ) / 2 - view_center.x;
-        const int j = p.y + getmaxy( w ) / 2 - view_center.y;
-        if( item_sym.empty() ) {
-            mvwputch( w, point( k, j ), tercol, sym );
-        } else {
-            mvwprintz( w, point( k, j ), tercol, item_sym );
-        }
-    }
+    const int k = p.x + getmaxx( w ) / 2 - view_center.x;
+    const int j = p.y + getmaxy( w ) / 2 - view_center.y;
+    draw_cell( w, point( k, j ), tercol, sym, item_sym, inorder );
 
     return !zlevels || sym != ' ' || !item_sym.empty() || p.z <= -OVERMAP_DEPTH ||
            !curr_ter.has_flag( TFLAG_NO_FLOOR );
@@ -5912,13 +6026,9 @@ void map::draw_from_above( const catacurses::window &w, const player &u, const t
         tercol = invert_color( tercol );
     }
 
-    if( inorder ) {
-        wputch( w, tercol, sym );
-    } else {
-        const int k = p.x + getmaxx( w ) / 2 - view_center.x;
-        const int j = p.y + getmaxy( w ) / 2 - view_center.y;
-        mvwputch( w, point( k, j ), tercol, sym );
-    }
+    const int k = p.x + getmaxx( w ) / 2 - view_center.x;
+    const int j = p.y + getmaxy( w ) / 2 - view_center.y;
+    draw_cell( w, point( k, j ), tercol, sym, std::string(), inorder );
 }
 
 bool map::sees( const tripoint &F, const tripoint &T, const int range ) const
@@ -5937,14 +6047,22 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range, int &bres
         bresenham_slope = 0;
         return false; // Out of range!
     }
+    if( F.z == T.z ) {
+        const int cached = get_cached_sight( F, T );
+        if( cached >= 0 ) {
+            return cached > 0;
+        }
+    }
     // Cannonicalize the order of the tripoints so the cache is reflexive.
     const tripoint &min = F < T ? F : T;
     const tripoint &max = !( F < T ) ? F : T;
     // A little gross, just pack the values into a point.
     const point key( min.x << 16 | min.y << 8 | min.z, max.x << 16 | max.y << 8 | max.z );
-    char cached = skew_vision_cache.get( key, -1 );
-    if( cached >= 0 ) {
-        return cached > 0;
+    if( F.z != T.z ) {
+        char cached = skew_vision_cache.get( key, -1 );
+        if( cached >= 0 ) {
+            return cached > 0;
+        }
     }
     bool visible = true;
 
@@ -5962,7 +6080,11 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range, int &bres
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        if( F.z == T.z ) {
+            cache_sight( F, T, visible );
+        } else {
+            skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        }
         return visible;
     }
 
@@ -5999,6 +6121,49 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range, int &bres
     return visible;
 }
 
+int map::get_cached_sight( const tripoint &F, const tripoint &T ) const
+{
+    if( !inbounds( F ) || !inbounds( T ) ) {
+        return -1;
+    }
+    const auto lookup = [this]( const tripoint & from, const tripoint & to ) {
+        const auto found = sight_caches.find( from );
+        if( found == sight_caches.end() || found->second.generation != sight_cache_generation ) {
+            return -1;
+        }
+        const size_t i = static_cast<size_t>( to.x + to.y * MAPSIZE_X );
+        if( !found->second.known[i] ) {
+            return -1;
+        }
+        return found->second.visible[i] ? 1 : 0;
+    };
+    // Check both directions so the cache stays reflexive
+    const int cached = lookup( F, T );
+    return cached >= 0 ? cached : lookup( T, F );
+}
+
+void map::cache_sight( const tripoint &F, const tripoint &T, const bool visible ) const
+{
+    if( !inbounds( F ) || !inbounds( T ) ) {
+        return;
+    }
+    // Keep the memory bounded when many positions were used as observers since
+    // the cache was last invalidated. Each entry takes a few kilobytes.
+    static constexpr size_t max_observers = 1024;
+    if( sight_caches.size() >= max_observers && sight_caches.count( F ) == 0 ) {
+        sight_caches.clear();
+    }
+    observer_sight_cache &cache = sight_caches[F];
+    if( cache.generation != sight_cache_generation ) {
+        cache.generation = sight_cache_generation;
+        cache.known.reset();
+        cache.visible.reset();
+    }
+    const size_t i = static_cast<size_t>( T.x + T.y * MAPSIZE_X );
+    cache.known.set( i );
+    cache.visible.set( i, visible );
+}
+
 int map::obstacle_coverage( const tripoint &loc1, const tripoint &loc2 ) const
 {
     // Can't hide if you are standing on furniture, or non-flat slowing-down terrain tile.
@@ -6600,6 +6765,8 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
 
     const int old_abs_z = abs_sub.z; // Ugly, but necessary at the moment
     abs_sub.z = grid.z;
+    // The loaded submap brings its own fields along
+    field_generation++;
 
     submap *tmpsub = MAPBUFFER.lookup_submap( grid_abs_sub );
     if( tmpsub == nullptr ) {
@@ -7739,6 +7906,7 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
 
     if( seen_cache_dirty ) {
         skew_vision_cache.clear();
+        sight_cache_generation++;
     }
     // Initial value is illegal player position.
     const tripoint &p = g->u.pos();
@@ -8236,6 +8404,7 @@ level_cache::level_cache()
     transparency_cache_dirty = true;
     outside_cache_dirty = true;
     floor_cache_dirty = false;
+    acoustic_cache_dirty = true;
     constexpr four_quadrants four_zeros( 0.0f );
     std::fill_n( &lm[0][0], map_dimensions, four_zeros );
     std::fill_n( &sm[0][0], map_dimensions, 0.0f );
@@ -8243,10 +8412,12 @@ level_cache::level_cache()
     std::fill_n( &outside_cache[0][0], map_dimensions, false );
     std::fill_n( &floor_cache[0][0], map_dimensions, false );
     std::fill_n( &transparency_cache[0][0], map_dimensions, 0.0f );
+    std::fill_n( &acoustic_cache[0][0], map_dimensions, 1 );
     std::fill_n( &vision_transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, LL_DARK );
+    std::fill_n( &visibility_stamps[0][0], MAPSIZE * MAPSIZE, 0 );
     veh_in_active_range = false;
     std::fill_n( &veh_exists_at[0][0], map_dimensions, false );
     max_populated_zlev = OVERMAP_HEIGHT;
@@ -8268,7 +8439,43 @@ void map::set_pathfinding_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
         get_pathfinding_cache( zlev ).dirty = true;
+        // Whatever changes movement also changes how sound travels
+        get_cache( zlev ).acoustic_cache_dirty = true;
+    }
+}
+
+void map::build_acoustic_cache( const int zlev )
+{
+    // Sound passing through a solid tile is muffled as much as by this many tiles of open air.
+    static constexpr std::uint8_t acoustic_cost_solid = 10;
+    // Windows and other see-through obstacles let more sound through.
+    static constexpr std::uint8_t acoustic_cost_transparent = 5;
+
+    auto &map_cache = get_cache( zlev );
+    if( !map_cache.acoustic_cache_dirty ) {
+        return;
+    }
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
+            for( int sx = 0; sx < SEEX; ++sx ) {
+                for( int sy = 0; sy < SEEY; ++sy ) {
+                    const ter_t &ter = cur_submap->get_ter( { sx, sy } ).obj();
+                    const furn_t &furn = cur_submap->get_furn( { sx, sy } ).obj();
+                    const point p( sx + smx * SEEX, sy + smy * SEEY );
+                    std::uint8_t &value = map_cache.acoustic_cache[p.x][p.y];
+                    if( ter.movecost != 0 && furn.movecost >= 0 ) {
+                        value = 1;
+                    } else if( ter.transparent && furn.transparent ) {
+                        value = acoustic_cost_transparent;
+                    } else {
+                        value = acoustic_cost_solid;
+                    }
+                }
+            }
+        }
     }
+    map_cache.acoustic_cache_dirty = false;
 }
 
 const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <functional>
@@ -44,6 +45,7 @@ namespace catacurses
 {
 class window;
 } // namespace catacurses
+class nc_color;
 class optional_vpart_position;
 class player;
 class monster;
@@ -161,6 +163,7 @@ struct level_cache {
     bool transparency_cache_dirty;
     bool outside_cache_dirty;
     bool floor_cache_dirty;
+    bool acoustic_cache_dirty;
 
     four_quadrants lm[MAPSIZE_X][MAPSIZE_Y];
     float sm[MAPSIZE_X][MAPSIZE_Y];
@@ -170,12 +173,22 @@ struct level_cache {
     bool outside_cache[MAPSIZE_X][MAPSIZE_Y];
     bool floor_cache[MAPSIZE_X][MAPSIZE_Y];
     float transparency_cache[MAPSIZE_X][MAPSIZE_Y];
+    // How much sound is muffled when passing through each tile, in tiles of open air
+    std::uint8_t acoustic_cache[MAPSIZE_X][MAPSIZE_Y];
     float vision_transparency_cache[MAPSIZE_X][MAPSIZE_Y];
     float seen_cache[MAPSIZE_X][MAPSIZE_Y];
     float camera_cache[MAPSIZE_X][MAPSIZE_Y];
     lit_level visibility_cache[MAPSIZE_X][MAPSIZE_Y];
+    // Stamp of the last change of @ref visibility_cache in each submap, no two changes
+    // anywhere get the same stamp
+    int visibility_stamps[MAPSIZE][MAPSIZE];
     std::bitset<MAPSIZE_X *MAPSIZE_Y> map_memory_seen_cache;
     std::bitset<MAPSIZE *MAPSIZE> field_cache;
+    // Double-buffered gas intensities and ages (in turns) and gas permeability used by
+    // map::diffuse_gases. This is only valid for the duration of diffuse_gases
+    std::uint8_t gas_intensity_buffer[2][MAPSIZE_X][MAPSIZE_Y];
+    int gas_age_buffer[2][MAPSIZE_X][MAPSIZE_Y];
+    bool gas_permeable_cache[MAPSIZE_X][MAPSIZE_Y];
 
     bool veh_in_active_range;
     bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
@@ -186,6 +199,18 @@ struct level_cache {
     int max_populated_zlev;
 };
 
+/**
+ * Results of map::sees from one observer position to the tiles on its z-level.
+ * Filled in as the tiles are queried, valid as long as @ref generation matches
+ * the one of the map.
+ */
+struct observer_sight_cache {
+    int generation = -1;
+    // Tiles whose visibility is in @ref visible, indexed by x + y * MAPSIZE_X
+    std::bitset<MAPSIZE_X *MAPSIZE_Y> known;
+    std::bitset<MAPSIZE_X *MAPSIZE_Y> visible;
+};
+
 /**
  * Manage and cache data about a part of the map.
  *
@@ -262,6 +287,7 @@ class map
                 ch.floor_cache_dirty = true;
                 ch.transparency_cache_dirty = true;
                 ch.outside_cache_dirty = true;
+                ch.acoustic_cache_dirty = true;
             }
         }
 
@@ -316,11 +342,24 @@ class map
          * `g->m` and maps with equivalent coordinates can be used, as other maps
          * would have coordinate systems incompatible with `g->u.posx()`
          *
+         * Cells that show the same as the last time the window was drawn are not written
+         * again, as long as nothing else was written to the window since, see @ref drawn_over.
+         *
          * @param w Window we are drawing in
          * @param center The coordinate of the center of the viewport, this can
          *               be different from the player coordinate.
          */
         void draw( const catacurses::window &w, const tripoint &center );
+        /**
+         * Tells that @p cells (in window coordinates) of the window were drawn over after
+         * @ref draw, and that nothing else in the window was changed. Without this any
+         * change of the window makes the next @ref draw write all cells again.
+         */
+        void drawn_over( const catacurses::window &w, const std::vector<point> &cells );
+        /** Number of cells written by the last @ref draw. */
+        int get_cells_drawn() const {
+            return cells_drawn;
+        }
 
         /** Draw the map tile at the given coordinate. Called by `map::draw()`.
         *
@@ -387,11 +426,12 @@ class map
         maptile maptile_at_internal( const tripoint &p );
         maptile maptile_has_bounds( const tripoint &p, bool bounds_checked );
         std::array<maptile, 8> get_neighbors( const tripoint &p );
-        void spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
+        /** @returns whether spreading changed the opacity of the destination tile. */
+        bool spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
                          const time_duration &outdoor_age_speedup, scent_block &sblk );
         void create_hot_air( const tripoint &p, int intensity );
         bool gas_can_spread_to( field_entry &cur, const maptile &dst );
-        void gas_spread_to( field_entry &cur, maptile &dst );
+        bool gas_spread_to( field_entry &cur, maptile &dst );
         int burn_body_part( player &u, field_entry &cur, body_part bp, int scale );
     public:
 
@@ -669,6 +709,22 @@ class map
         bool ter_set( const point &p, const ter_id &new_terrain ) {
             return ter_set( tripoint( p, abs_sub.z ), new_terrain );
         }
+        /**
+         * Counts the changes of terrain and furniture on all maps, anything derived from them
+         * stays valid as long as this doesn't change.
+         */
+        static int get_terrain_generation() {
+            return terrain_generation;
+        }
+        /**
+         * Counts the fields that were created or loaded on all maps, a list of field locations
+         * misses none of them as long as this doesn't change.
+         */
+        static int get_field_generation() {
+            return field_generation;
+        }
+        /** @ref submap::get_terrain_stamp of the submap at grid position @p gridp. */
+        int get_terrain_stamp( const tripoint &gridp ) const;
 
         std::string tername( const tripoint &p ) const;
         std::string tername( const point &p ) const {
@@ -1156,6 +1212,14 @@ class map
         // See fields.cpp
         bool process_fields();
         bool process_fields_in_submap( submap *current_submap, const tripoint &submap_pos );
+        /**
+         * Spreads all gaseous fields on the given z-level by one step at once.
+         * Used instead of the tile by tile @ref spread_gas when the "GAS_DIFFUSION" option is set.
+         * Each step reads the current intensities and writes to a separate buffer,
+         * so the result doesn't depend on the order in which tiles are visited.
+         * @returns whether the transparency of any tile changed.
+         */
+        bool diffuse_gases( int zlev );
         /**
          * Apply field effects to the creature when it's on a square with fields.
          */
@@ -1231,6 +1295,11 @@ class map
          * @return NULL if there is no such field entry at that place.
          */
         field_entry *get_field( const tripoint &p, const field_type_id &type );
+        /**
+         * Get all the points of the z-level @p zlev that have a field of the given type.
+         * Only the submaps and tiles that hold fields are visited.
+         */
+        std::vector<tripoint> get_field_locations( const field_type_id &type, int zlev );
         bool dangerous_field_at( const tripoint &p );
         /**
          * Add field entry at point, or set intensity if present
@@ -1565,6 +1634,8 @@ class map
         // Builds a floor cache and returns true if the cache was invalidated.
         // Used to determine if seen cache should be rebuilt.
         bool build_floor_cache( int zlev );
+        // Rebuilds the acoustic cache if terrain or furniture changed since it was last built.
+        void build_acoustic_cache( int zlev );
         // We want this visible in `game`, because we want it built earlier in the turn than the rest
         void build_floor_caches();
 
@@ -1664,6 +1735,13 @@ class map
         bool draw_maptile_from_memory( const catacurses::window &w, const tripoint &p,
                                        const tripoint &view_center,
                                        bool move_cursor = true ) const;
+        /**
+         * Writes @p sym, or @p str if it is not empty, to the @p cell of the window.
+         * While @ref draw is running this skips cells that still show the same and moves
+         * the cursor, otherwise the cursor is only moved if @p inorder is false.
+         */
+        void draw_cell( const catacurses::window &w, const point &cell, const nc_color &color,
+                        int sym, const std::string &str, bool inorder ) const;
         /**
          * Draws the tile as seen from above.
          */
@@ -1771,9 +1849,38 @@ class map
         std::set<tripoint> submaps_with_active_items;
 
         /**
-         * Cache of coordinate pairs recently checked for visibility.
+         * Cache of coordinate pairs on different z-levels recently checked for visibility.
          */
         mutable lru_cache<point, char> skew_vision_cache;
+        /**
+         * Visibility checked from each observer position to tiles on the same z-level.
+         * Entries are reused between turns, bumping @ref sight_cache_generation
+         * invalidates all of them.
+         */
+        mutable std::unordered_map<tripoint, observer_sight_cache> sight_caches;
+        int sight_cache_generation = 0;
+        static int terrain_generation;
+        static int field_generation;
+
+        /** What @ref draw last wrote to a cell of the window. */
+        struct drawn_cell {
+            int sym = -1;
+            std::string str;
+            int color = 0;
+        };
+        // Cells of the window last drawn by @ref draw, row by row
+        mutable std::vector<drawn_cell> drawn_cells;
+        std::weak_ptr<void> drawn_window;
+        point drawn_size;
+        // Change count of @ref drawn_window when @ref drawn_cells matched its contents
+        int drawn_change_count = 0;
+        // Set while @ref draw runs
+        bool drawing_cells = false;
+        mutable int cells_drawn = 0;
+
+        /** Looks up the cached result of sees( F, T ), returns -1 if it isn't known. */
+        int get_cached_sight( const tripoint &F, const tripoint &T ) const;
+        void cache_sight( const tripoint &F, const tripoint &T, bool visible ) const;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
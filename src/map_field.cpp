@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <algorithm>
 #include <queue>
+#include <set>
 #include <tuple>
 #include <iterator>
 #include <list>
@@ -32,6 +33,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npc.h"
+#include "options.h"
 #include "overmapbuffer.h"
 #include "rng.h"
 #include "scent_map.h"
@@ -121,8 +123,9 @@ bool map::process_fields()
     bool dirty_transparency_cache = false;
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    const bool gas_diffusion = get_option<bool>( "GAS_DIFFUSION" );
     for( int z = minz; z <= maxz; z++ ) {
-        bool zlev_dirty = false;
+        bool zlev_dirty = gas_diffusion && diffuse_gases( z );
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
             for( int y = 0; y < my_MAPSIZE; y++ ) {
@@ -135,12 +138,6 @@ bool map::process_fields()
         }
 
         if( zlev_dirty ) {
-            // For now, just always dirty the transparency cache
-            // when a field might possibly be changed.
-            // TODO: check if there are any fields(mostly fire)
-            //       that frequently change, if so set the dirty
-            //       flag, otherwise only set the dirty flag if
-            //       something actually changed
             set_transparency_cache_dirty( z );
             dirty_transparency_cache = true;
         }
@@ -167,6 +164,178 @@ static int ter_furn_movecost( const ter_t &ter, const furn_t &furn )
     return ter.movecost + furn.movecost;
 }
 
+// Order independent roll in [1, 100] for spreading a gas from the tile at absolute position p.
+static int gas_diffusion_roll( const tripoint &p, const field_type_id &gas )
+{
+    uint32_t h = static_cast<uint32_t>( to_turn<int>( calendar::turn ) );
+    for( const int v : {
+             p.x, p.y, p.z, gas.to_i()
+         } ) {
+        h ^= static_cast<uint32_t>( v ) + 0x9e3779b9u + ( h << 6 ) + ( h >> 2 );
+    }
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    return static_cast<int>( h % 100 ) + 1;
+}
+
+bool map::diffuse_gases( const int zlev )
+{
+    auto &map_cache = get_cache( zlev );
+    auto &front = map_cache.gas_intensity_buffer[0];
+    auto &back = map_cache.gas_intensity_buffer[1];
+    auto &front_age = map_cache.gas_age_buffer[0];
+    auto &back_age = map_cache.gas_age_buffer[1];
+    auto &permeable = map_cache.gas_permeable_cache;
+
+    // Collect the spreading gases and the area they cover
+    std::set<field_type_id> gases;
+    point min_p( MAPSIZE_X, MAPSIZE_Y );
+    point max_p( -1, -1 );
+    for( int smx = 0; smx < my_MAPSIZE; smx++ ) {
+        for( int smy = 0; smy < my_MAPSIZE; smy++ ) {
+            if( !map_cache.field_cache[smx + smy * MAPSIZE] ) {
+                continue;
+            }
+            submap *const sm = get_submap_at_grid( { smx, smy, zlev } );
+            for( int sx = 0; sx < SEEX; sx++ ) {
+                for( int sy = 0; sy < SEEY; sy++ ) {
+                    if( !sm->field_tiles[submap::field_tile_index( { sx, sy } )] ) {
+                        continue;
+                    }
+                    for( auto &fp : sm->get_field( { sx, sy } ) ) {
+                        if( !fp.second.gas_can_spread() ) {
+                            continue;
+                        }
+                        gases.insert( fp.first );
+                        const point p( sx + smx * SEEX, sy + smy * SEEY );
+                        min_p = point( std::min( min_p.x, p.x ), std::min( min_p.y, p.y ) );
+                        max_p = point( std::max( max_p.x, p.x ), std::max( max_p.y, p.y ) );
+                    }
+                }
+            }
+        }
+    }
+    if( gases.empty() ) {
+        return false;
+    }
+    // Gas can spread one tile out of the covered area
+    min_p = point( std::max( min_p.x - 1, 0 ), std::max( min_p.y - 1, 0 ) );
+    max_p = point( std::min( max_p.x + 1, SEEX * my_MAPSIZE - 1 ),
+                   std::min( max_p.y + 1, SEEY * my_MAPSIZE - 1 ) );
+
+    for( int x = min_p.x; x <= max_p.x; x++ ) {
+        for( int y = min_p.y; y <= max_p.y; y++ ) {
+            const maptile tile = maptile_at_internal( tripoint( x, y, zlev ) );
+            const ter_t &ter = tile.get_ter_t();
+            const furn_t &frn = tile.get_furn_t();
+            permeable[x][y] = ter_furn_movecost( ter, frn ) > 0 ||
+                              ter_furn_has_flag( ter, frn, TFLAG_PERMEABLE );
+        }
+    }
+
+    bool dirty_transparency_cache = false;
+    for( const field_type_id &gas : gases ) {
+        const field_type &fdata = gas.obj();
+        const int max_intensity = fdata.get_max_intensity();
+        for( int x = min_p.x; x <= max_p.x; x++ ) {
+            for( int y = min_p.y; y <= max_p.y; y++ ) {
+                const maptile tile = maptile_at_internal( tripoint( x, y, zlev ) );
+                const field_entry *cur = tile.get_field().find_field_c( gas );
+                const bool alive = cur != nullptr && cur->is_field_alive();
+                front[x][y] = alive ? cur->get_field_intensity() : 0;
+                front_age[x][y] = alive ? to_turns<int>( cur->get_field_age() ) : 0;
+                back_age[x][y] = front_age[x][y];
+            }
+        }
+
+        // Every tile with enough gas moves one unit of it to its thinnest permeable neighbor.
+        // Only the front buffer is read here, so the visiting order doesn't matter.
+        const auto spread_target = [&]( const point & p ) {
+            point target( -1, -1 );
+            const int intensity = front[p.x][p.y];
+            if( intensity <= 1 ) {
+                return target;
+            }
+            const int roll = gas_diffusion_roll( getabs( tripoint( p, zlev ) ), gas );
+            if( roll > fdata.percent_spread ) {
+                return target;
+            }
+            int target_intensity = intensity;
+            // Start at a rolled direction so ties don't favor one side
+            for( size_t i = 0; i < eight_horizontal_neighbors.size(); i++ ) {
+                const point n = p + eight_horizontal_neighbors[( roll + i ) %
+                                eight_horizontal_neighbors.size()].xy();
+                if( n.x < min_p.x || n.x > max_p.x || n.y < min_p.y || n.y > max_p.y ||
+                    !permeable[n.x][n.y] ) {
+                    continue;
+                }
+                if( front[n.x][n.y] < target_intensity ) {
+                    target = n;
+                    target_intensity = front[n.x][n.y];
+                }
+            }
+            return target;
+        };
+        // The back buffer counts the units each tile would receive
+        for( int x = min_p.x; x <= max_p.x; x++ ) {
+            std::fill_n( &back[x][min_p.y], max_p.y - min_p.y + 1, 0 );
+        }
+        for( int x = min_p.x; x <= max_p.x; x++ ) {
+            for( int y = min_p.y; y <= max_p.y; y++ ) {
+                const point target = spread_target( point( x, y ) );
+                if( target.x >= 0 ) {
+                    back[target.x][target.y]++;
+                }
+            }
+        }
+        // A tile that would end up with more gas than the field allows takes none of it,
+        // so no gas is lost. This only depends on the buffers, not on the visiting order.
+        const auto accepts = [&]( const point & p ) {
+            return front[p.x][p.y] + back[p.x][p.y] <= max_intensity;
+        };
+        for( int x = min_p.x; x <= max_p.x; x++ ) {
+            for( int y = min_p.y; y <= max_p.y; y++ ) {
+                const point target = spread_target( point( x, y ) );
+                if( target.x < 0 || !accepts( target ) ) {
+                    continue;
+                }
+                // Nearby gas grows thicker, and ages are shared, like in gas_spread_to
+                const int age_fraction = front_age[x][y] / front[x][y];
+                back_age[x][y] -= age_fraction;
+                back_age[target.x][target.y] += age_fraction;
+            }
+        }
+
+        // Write the changed intensities back to the fields
+        for( int x = min_p.x; x <= max_p.x; x++ ) {
+            for( int y = min_p.y; y <= max_p.y; y++ ) {
+                const point here( x, y );
+                const point target = spread_target( here );
+                const int intensity = front[x][y] + ( accepts( here ) ? back[x][y] : 0 ) -
+                                      ( target.x >= 0 && accepts( target ) ? 1 : 0 );
+                if( intensity == front[x][y] && back_age[x][y] == front_age[x][y] ) {
+                    continue;
+                }
+                maptile tile = maptile_at_internal( tripoint( x, y, zlev ) );
+                const time_duration age = time_duration::from_turns( back_age[x][y] );
+                const bool was_transparent = front[x][y] == 0 ||
+                                             fdata.get_transparent( front[x][y] - 1 );
+                const bool is_transparent = intensity == 0 ||
+                                            fdata.get_transparent( intensity - 1 );
+                dirty_transparency_cache |= was_transparent != is_transparent;
+                if( field_entry *cur = tile.find_field( gas ) ) {
+                    cur->set_field_intensity( intensity );
+                    cur->set_field_age( age );
+                } else if( tile.add_field( gas, intensity, age ) ) {
+                    map_cache.field_cache.set( x / SEEX + ( y / SEEY ) * MAPSIZE );
+                }
+            }
+        }
+    }
+    return dirty_transparency_cache;
+}
+
 // Wrapper to allow skipping bound checks except at the edges of the map
 maptile map::maptile_has_bounds( const tripoint &p, const bool bounds_checked )
 {
@@ -209,11 +378,25 @@ bool map::gas_can_spread_to( field_entry &cur, const maptile &dst )
            ( tmpfld == nullptr || tmpfld->get_field_intensity() < cur.get_field_intensity() );
 }
 
-void map::gas_spread_to( field_entry &cur, maptile &dst )
+// Combined translucency of the opaque fields on a tile, as applied by the transparency cache.
+static float field_translucency( const field &fld )
+{
+    float translucency = 1.0f;
+    for( const auto &fp : fld ) {
+        const field_entry &cur = fp.second;
+        if( !cur.is_transparent() ) {
+            translucency *= cur.translucency();
+        }
+    }
+    return translucency;
+}
+
+bool map::gas_spread_to( field_entry &cur, maptile &dst )
 {
     const field_type_id current_type = cur.get_field_type();
     const time_duration current_age = cur.get_field_age();
     const int current_intensity = cur.get_field_intensity();
+    const float dst_translucency = field_translucency( dst.get_field() );
     field_entry *candidate_field = dst.find_field( current_type );
     // Nearby gas grows thicker, and ages are shared.
     const time_duration age_fraction = current_age / current_intensity;
@@ -228,9 +411,10 @@ void map::gas_spread_to( field_entry &cur, maptile &dst )
         cur.set_field_intensity( current_intensity - 1 );
         cur.set_field_age( current_age - age_fraction );
     }
+    return field_translucency( dst.get_field() ) != dst_translucency;
 }
 
-void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
+bool map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
                       const time_duration &outdoor_age_speedup, scent_block &sblk )
 {
     const oter_id &cur_om_ter = overmap_buffer.ter( ms_to_omt_copy( g->m.getabs( p ) ) );
@@ -260,7 +444,7 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
 
     // Bail out if we don't meet the spread chance or required intensity.
     if( current_intensity <= 1 || rng( 1, 100 - windpower ) > percent_spread ) {
-        return;
+        return false;
     }
 
     // First check if we can fall
@@ -269,8 +453,7 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
         const tripoint down{ p.xy(), p.z - 1 };
         maptile down_tile = maptile_at_internal( down );
         if( gas_can_spread_to( cur, down_tile ) && valid_move( p, down, true, true ) ) {
-            gas_spread_to( cur, down_tile );
-            return;
+            return gas_spread_to( cur, down_tile );
         }
     }
 
@@ -298,7 +481,7 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
     if( !spread.empty() && ( !zlevels || one_in( spread.size() ) ) ) {
         // Construct the destination from offset and p
         if( g->is_sheltered( p ) || windpower < 5 ) {
-            gas_spread_to( cur, neighs[ random_entry( spread ) ] );
+            return gas_spread_to( cur, neighs[ random_entry( spread ) ] );
         } else {
             end_it = static_cast<size_t>( rng( 0, neighs.size() - 1 ) );
             // Start at end_it + 1, then wrap around until all elements have been processed.
@@ -315,16 +498,17 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
                 }
             }
             if( !neighbour_vec.empty() ) {
-                gas_spread_to( cur, neighbour_vec[rng( 0, neighbour_vec.size() - 1 )] );
+                return gas_spread_to( cur, neighbour_vec[rng( 0, neighbour_vec.size() - 1 )] );
             }
         }
     } else if( zlevels && p.z < OVERMAP_HEIGHT ) {
         const tripoint up{ p.xy(), p.z + 1 };
         maptile up_tile = maptile_at_internal( up );
         if( gas_can_spread_to( cur, up_tile ) && valid_move( p, up, true, true ) ) {
-            gas_spread_to( cur, up_tile );
+            return gas_spread_to( cur, up_tile );
         }
     }
+    return false;
 }
 
 /*
@@ -359,7 +543,8 @@ void map::create_hot_air( const tripoint &p, int intensity )
 
 /*
 Function: process_fields_in_submap
-Iterates over every field on every tile of the given submap given as parameter.
+Iterates over every field on the tiles of the given submap that hold fields,
+see submap::field_tiles.
 This is the general update function for field effects. This should only be called once per game turn.
 If you need to insert a new field behavior per unit time add a case statement in the switch below.
 */
@@ -367,6 +552,7 @@ bool map::process_fields_in_submap( submap *const current_submap,
                                     const tripoint &submap )
 {
     scent_block sblk( submap.x, submap.y, submap.z, g->scent );
+    const bool gas_diffusion = get_option<bool>( "GAS_DIFFUSION" );
 
     // This should be true only when the field changes transparency
     // More correctly: not just when the field is opaque, but when it changes state
@@ -386,6 +572,12 @@ bool map::process_fields_in_submap( submap *const current_submap,
     // Loop through all tiles in this submap indicated by current_submap
     for( locx = 0; locx < SEEX; locx++ ) {
         for( locy = 0; locy < SEEY; locy++ ) {
+            // Skip the tiles that can't have any fields. Fields spread to later tiles
+            // are still processed on this pass, same as with a full scan.
+            const size_t tile_index = submap::field_tile_index( map_tile.pos() );
+            if( !current_submap->field_tiles[tile_index] ) {
+                continue;
+            }
             // This is a translation from local coordinates to submap coordinates.
             // All submaps are in one long 1d array.
             thep.x = locx + submap.x * SEEX;
@@ -395,6 +587,8 @@ bool map::process_fields_in_submap( submap *const current_submap,
             // Get a reference to the field variable from the submap;
             // contains all the pointers to the real field effects.
             field &curfield = current_submap->get_field( { static_cast<int>( locx ), static_cast<int>( locy ) } );
+            // Only dirty the transparency cache if the opacity of the tile actually changes
+            const float translucency_before = field_translucency( curfield );
             for( auto it = curfield.begin(); it != curfield.end(); ) {
                 // Iterating through all field effects in the submap's field.
                 field_entry &cur = it->second;
@@ -416,7 +610,10 @@ bool map::process_fields_in_submap( submap *const current_submap,
                     debugmsg( "Whoooooa intensity of %d", cur.get_field_intensity() );
                 }
 
-                dirty_transparency_cache = curtype.obj().dirty_transparency_cache;
+                // Gases only change transparency on their own tile or by spreading, checked separately
+                if( curtype.obj().dirty_transparency_cache && curtype.obj().phase != GAS ) {
+                    dirty_transparency_cache = true;
+                }
 
                 // Don't process "newborn" fields. This gives the player time to run if they need to.
                 if( cur.get_field_age() == 0_turns ) {
@@ -954,7 +1151,10 @@ bool map::process_fields_in_submap( submap *const current_submap,
                     const int gas_percent_spread = curtype.obj().percent_spread;
                     if( gas_percent_spread > 0 ) {
                         const time_duration outdoor_age_speedup = curtype.obj().outdoor_age_speedup;
-                        spread_gas( cur, p, gas_percent_spread, outdoor_age_speedup, sblk );
+                        // With gas diffusion the spreading itself was already done by diffuse_gases
+                        dirty_transparency_cache |= spread_gas( cur, p,
+                                                                gas_diffusion ? 0 : gas_percent_spread,
+                                                                outdoor_age_speedup, sblk );
                     }
                 }
 
@@ -1244,7 +1444,7 @@ bool map::process_fields_in_submap( submap *const current_submap,
                                 }
                             }
                         } else {
-                            spread_gas( cur, p, 5, 0_turns, sblk );
+                            dirty_transparency_cache |= spread_gas( cur, p, 5, 0_turns, sblk );
                         }
                     }
                 }
@@ -1295,6 +1495,12 @@ bool map::process_fields_in_submap( submap *const current_submap,
                     ++it;
                 }
             }
+            if( curfield.field_count() == 0 ) {
+                current_submap->field_tiles.reset( tile_index );
+            }
+            if( field_translucency( curfield ) != translucency_before ) {
+                dirty_transparency_cache = true;
+            }
         }
     }
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
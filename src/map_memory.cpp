@@ -1,30 +1,176 @@
 #include "map_memory.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "coordinate_conversions.h"
+
 static const memorized_terrain_tile default_tile{ "", 0, 0 };
 
+// Tile ids remembered by any map memory, the same few hundred ids come up everywhere.
+static std::vector<std::string> &interned_tile_ids()
+{
+    static std::vector<std::string> ids{ "" };
+    return ids;
+}
+
+std::uint32_t map_memory::intern_tile( const std::string &id )
+{
+    static std::unordered_map<std::string, std::uint32_t> interned{ { "", 0 } };
+    const auto found = interned.find( id );
+    if( found != interned.end() ) {
+        return found->second;
+    }
+    std::vector<std::string> &ids = interned_tile_ids();
+    const std::uint32_t result = ids.size();
+    ids.push_back( id );
+    interned.emplace( id, result );
+    return result;
+}
+
+const std::string &map_memory::tile_id( std::uint32_t tile )
+{
+    return interned_tile_ids()[tile];
+}
+
+static size_t index_in_submap( const point &remain )
+{
+    return remain.x + remain.y * SEEX;
+}
+
+const map_memory::submap_memory *map_memory::find_submap( const tripoint &pos,
+        size_t &index ) const
+{
+    tripoint remain = pos;
+    const tripoint sm = ms_to_sm_remain( remain );
+    const auto found = submaps.find( sm );
+    if( found == submaps.end() ) {
+        return nullptr;
+    }
+    index = index_in_submap( remain.xy() );
+    return &found->second;
+}
+
+map_memory::submap_memory &map_memory::touch_submap( const tripoint &pos, size_t &index )
+{
+    tripoint remain = pos;
+    const tripoint sm = ms_to_sm_remain( remain );
+    index = index_in_submap( remain.xy() );
+    const auto found = submaps.find( sm );
+    if( found != submaps.end() ) {
+        recent.splice( recent.end(), recent, found->second.recency );
+        return found->second;
+    }
+    submap_memory &mem = submaps[sm];
+    mem.recency = recent.insert( recent.end(), sm );
+    return mem;
+}
+
+void map_memory::forget_submap( const tripoint &sm )
+{
+    const auto found = submaps.find( sm );
+    if( found == submaps.end() ) {
+        return;
+    }
+    memorized -= found->second.memorized;
+    recent.erase( found->second.recency );
+    submaps.erase( found );
+}
+
+void map_memory::update_memorized( const tripoint &sm, submap_memory &mem, size_t index,
+                                   bool had_memory )
+{
+    const bool has_memory = mem.has_memory( index );
+    if( has_memory && !had_memory ) {
+        mem.memorized++;
+        memorized++;
+    } else if( !has_memory && had_memory ) {
+        mem.memorized--;
+        memorized--;
+    }
+    if( mem.memorized == 0 ) {
+        forget_submap( sm );
+    }
+}
+
+void map_memory::trim( int limit, const tripoint &keep )
+{
+    while( memorized > static_cast<size_t>( std::max( limit, 0 ) ) && recent.front() != keep ) {
+        forget_submap( recent.front() );
+    }
+}
+
 memorized_terrain_tile map_memory::get_tile( const tripoint &pos ) const
 {
-    return tile_cache.get( pos, default_tile );
+    size_t index = 0;
+    const submap_memory *mem = find_submap( pos, index );
+    if( mem == nullptr || mem->tiles[index].tile == 0 ) {
+        return default_tile;
+    }
+    const memorized_tile &tile = mem->tiles[index];
+    return memorized_terrain_tile{ tile_id( tile.tile ), tile.subtile, tile.rotation };
 }
 
 void map_memory::memorize_tile( int limit, const tripoint &pos, const std::string &ter,
                                 const int subtile, const int rotation )
 {
-    tile_cache.insert( limit, pos, memorized_terrain_tile{ ter, subtile, rotation } );
+    size_t index = 0;
+    submap_memory &mem = touch_submap( pos, index );
+    const bool had_memory = mem.has_memory( index );
+    memorized_tile &tile = mem.tiles[index];
+    // Most redraws memorize what is already remembered, skip the interning then.
+    if( tile.tile == 0 || tile_id( tile.tile ) != ter ) {
+        tile.tile = intern_tile( ter );
+    }
+    tile.subtile = subtile;
+    tile.rotation = rotation;
+    const tripoint sm = ms_to_sm_copy( pos );
+    update_memorized( sm, mem, index, had_memory );
+    trim( limit, sm );
 }
 
 int map_memory::get_symbol( const tripoint &pos ) const
 {
-    return symbol_cache.get( pos, 0 );
+    size_t index = 0;
+    const submap_memory *mem = find_submap( pos, index );
+    return mem != nullptr ? mem->symbols[index] : 0;
 }
 
 void map_memory::memorize_symbol( int limit, const tripoint &pos, const int symbol )
 {
-    symbol_cache.insert( limit, pos, symbol );
+    size_t index = 0;
+    submap_memory &mem = touch_submap( pos, index );
+    const bool had_memory = mem.has_memory( index );
+    mem.symbols[index] = symbol;
+    const tripoint sm = ms_to_sm_copy( pos );
+    update_memorized( sm, mem, index, had_memory );
+    trim( limit, sm );
 }
 
 void map_memory::clear_memorized_tile( const tripoint &pos )
 {
-    tile_cache.remove( pos );
-    symbol_cache.remove( pos );
+    tripoint remain = pos;
+    const tripoint sm = ms_to_sm_remain( remain );
+    const auto found = submaps.find( sm );
+    if( found == submaps.end() ) {
+        return;
+    }
+    const size_t index = index_in_submap( remain.xy() );
+    submap_memory &mem = found->second;
+    const bool had_memory = mem.has_memory( index );
+    mem.tiles[index] = memorized_tile();
+    mem.symbols[index] = 0;
+    update_memorized( sm, mem, index, had_memory );
+}
+
+void map_memory::clear()
+{
+    submaps.clear();
+    recent.clear();
+    memorized = 0;
+}
+
+size_t map_memory::size() const
+{
+    return memorized;
 }
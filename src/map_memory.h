@@ -2,9 +2,13 @@
 #ifndef MAP_MEMORY_H
 #define MAP_MEMORY_H
 
+#include <array>
+#include <cstdint>
+#include <list>
 #include <string>
+#include <unordered_map>
 
-#include "lru_cache.h"
+#include "game_constants.h"
 #include "point.h" // IWYU pragma: keep
 
 class JsonOut;
@@ -17,6 +21,12 @@ struct memorized_terrain_tile {
     int rotation;
 };
 
+/**
+ * The tiles and symbols the avatar remembers, stored per submap.
+ * Tile ids are interned, a memorized tile is a few integers.
+ * When more than the given limit of positions are remembered, whole submaps
+ * are forgotten, least recently memorized first.
+ */
 class map_memory
 {
     public:
@@ -34,9 +44,49 @@ class map_memory
         int get_symbol( const tripoint &pos ) const;
 
         void clear_memorized_tile( const tripoint &pos );
+
+        /** Number of remembered positions. */
+        size_t size() const;
     private:
-        lru_cache<tripoint, memorized_terrain_tile> tile_cache;
-        lru_cache<tripoint, int> symbol_cache;
+        struct memorized_tile {
+            // Index in the interned tile ids, 0 being no tile
+            std::uint32_t tile = 0;
+            std::int16_t subtile = 0;
+            std::int16_t rotation = 0;
+        };
+        struct submap_memory {
+            std::array<memorized_tile, SEEX *SEEY> tiles;
+            std::array<int, SEEX *SEEY> symbols;
+            // Positions that have a tile or a symbol
+            int memorized = 0;
+            // Position in @ref recent
+            std::list<tripoint>::iterator recency;
+
+            submap_memory() {
+                symbols.fill( 0 );
+            }
+            bool has_memory( size_t i ) const {
+                return tiles[i].tile != 0 || symbols[i] != 0;
+            }
+        };
+
+        static std::uint32_t intern_tile( const std::string &id );
+        static const std::string &tile_id( std::uint32_t tile );
+
+        /** Finds the submap and the index in it of a position, nullptr if nothing is remembered. */
+        const submap_memory *find_submap( const tripoint &pos, size_t &index ) const;
+        /** Finds or creates the submap of a position and marks it as the most recent. */
+        submap_memory &touch_submap( const tripoint &pos, size_t &index );
+        void forget_submap( const tripoint &sm );
+        void clear();
+        void update_memorized( const tripoint &sm, submap_memory &mem, size_t index, bool had_memory );
+        void trim( int limit, const tripoint &keep );
+
+        // Keyed by absolute submap coordinates
+        std::unordered_map<tripoint, submap_memory> submaps;
+        // Submaps from the least to the most recently memorized
+        std::list<tripoint> recent;
+        size_t memorized = 0;
 };
 
 #endif
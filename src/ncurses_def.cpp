@@ -14,6 +14,7 @@
 #endif
 
 #include <stdexcept>
+#include <unordered_map>
 
 #include "cursesdef.h"
 #include "catacharset.h"
@@ -30,11 +31,20 @@ static void curses_check_result( const int result, const int expected, const cha
     }
 }
 
+// Changes made to each window, see catacurses::get_change_count
+static std::unordered_map<const void *, int> change_counts;
+
+static void count_change( const catacurses::window &win )
+{
+    ++change_counts[win.get()];
+}
+
 catacurses::window catacurses::newwin( const int nlines, const int ncols, const point &begin )
 {
     // TODO: check for errors
     const auto w = ::newwin( nlines, ncols, begin.y, begin.x );
     return std::shared_ptr<void>( w, []( void *const w ) {
+        change_counts.erase( w );
         ::curses_check_result( ::delwin( static_cast<::WINDOW *>( w ) ), OK, "delwin" );
     } );
 }
@@ -46,6 +56,7 @@ void catacurses::wrefresh( const window &win )
 
 void catacurses::werase( const window &win )
 {
+    count_change( win );
     return curses_check_result( ::werase( win.get<::WINDOW>() ), OK, "werase" );
 }
 
@@ -96,12 +107,14 @@ void catacurses::wmove( const window &win, const point &p )
 
 void catacurses::mvwprintw( const window &win, const point &p, const std::string &text )
 {
+    count_change( win );
     return curses_check_result( ::mvwprintw( win.get<::WINDOW>(), p.y, p.x, "%s", text.c_str() ),
                                 OK, "mvwprintw" );
 }
 
 void catacurses::wprintw( const window &win, const std::string &text )
 {
+    count_change( win );
     return curses_check_result( ::wprintw( win.get<::WINDOW>(), "%s", text.c_str() ),
                                 OK, "wprintw" );
 }
@@ -129,29 +142,34 @@ void catacurses::endwin()
 void catacurses::wborder( const window &win, const chtype ls, const chtype rs, const chtype ts,
                           const chtype bs, const chtype tl, const chtype tr, const chtype bl, const chtype br )
 {
+    count_change( win );
     return curses_check_result( ::wborder( win.get<::WINDOW>(), ls, rs, ts, bs, tl, tr, bl, br ), OK,
                                 "wborder" );
 }
 
 void catacurses::mvwhline( const window &win, const point &p, const chtype ch, const int n )
 {
+    count_change( win );
     return curses_check_result( ::mvwhline( win.get<::WINDOW>(), p.y, p.x, ch, n ), OK,
                                 "mvwhline" );
 }
 
 void catacurses::mvwvline( const window &win, const point &p, const chtype ch, const int n )
 {
+    count_change( win );
     return curses_check_result( ::mvwvline( win.get<::WINDOW>(), p.y, p.x, ch, n ), OK,
                                 "mvwvline" );
 }
 
 void catacurses::mvwaddch( const window &win, const point &p, const chtype ch )
 {
+    count_change( win );
     return curses_check_result( ::mvwaddch( win.get<::WINDOW>(), p.y, p.x, ch ), OK, "mvwaddch" );
 }
 
 void catacurses::waddch( const window &win, const chtype ch )
 {
+    count_change( win );
     return curses_check_result( ::waddch( win.get<::WINDOW>(), ch ), OK, "waddch" );
 }
 
@@ -163,9 +181,21 @@ void catacurses::wredrawln( const window &win, const int beg_line, const int num
 
 void catacurses::wclear( const window &win )
 {
+    count_change( win );
     return curses_check_result( ::wclear( win.get<::WINDOW>() ), OK, "wclear" );
 }
 
+void catacurses::touchwin( const window &win )
+{
+    return curses_check_result( ::touchwin( win.get<::WINDOW>() ), OK, "touchwin" );
+}
+
+int catacurses::get_change_count( const window &win )
+{
+    const auto it = change_counts.find( win.get() );
+    return it == change_counts.end() ? 0 : it->second;
+}
+
 void catacurses::curs_set( const int visibility )
 {
     return curses_check_result( ::curs_set( visibility ), OK, "curs_set" );
@@ -540,6 +540,14 @@ struct npc_short_term_cache {
     std::map<direction, float> threat_map;
     // Cache of locations the NPC has searched recently in npc::find_item()
     lru_cache<tripoint, int> searched_tiles;
+
+    // An NPC that decided to pause keeps pausing without thinking again until this turn,
+    // unless what it decided on changes, see npc::think_is_due
+    time_point next_think = calendar::before_time_starts;
+    int think_hp = 0;
+    size_t think_creatures = 0;
+    npc_attitude think_attitude = NPCATT_NULL;
+    npc_mission think_mission = NPC_MISSION_NULL;
 };
 
 // DO NOT USE! This is old, use strings as talk topic instead, e.g. "TALK_AGREE_FOLLOW" instead of
@@ -1031,6 +1039,12 @@ class npc : public player
 
         // Movement; the following are defined in npcmove.cpp
         void move(); // Picks an action & a target and calls execute_action
+        /**
+         * Whether the NPC has to think about what to do on its next move. A pausing NPC only
+         * does so every few turns, or once it gets hurt, new creatures show up, it hears
+         * something, its attitude or mission changes or it gets talked to.
+         */
+        bool think_is_due() const;
         void execute_action( npc_action action ); // Performs action
         void process_turn() override;
 
@@ -9,6 +9,7 @@
 #include <tuple>
 #include <cmath>
 #include <type_traits>
+#include <unordered_map>
 #include <cfloat>
 
 #include "activity_handlers.h"
@@ -160,6 +161,54 @@ const std::vector<bionic_id> weapon_cbms = { {
 
 const int avoidance_vehicles_radius = 5;
 
+// The parts of the danger assessment that are the same for every NPC, gathered once
+// per turn and shared by all the NPCs that think during that turn.
+struct shared_threats {
+    time_point turn = calendar::before_time_starts;
+    tripoint abs_sub;
+    int field_generation = -1;
+    // Fires on each z-level, they may have burned out since
+    std::map<int, std::vector<tripoint>> fires;
+    // Weapon value of each character and the weapon (type and charges) it was rated for
+    std::unordered_map<const player *, std::tuple<itype_id, int, double>> weapon_values;
+};
+
+shared_threats &get_shared_threats()
+{
+    static shared_threats threats;
+    if( threats.turn != calendar::turn || threats.abs_sub != g->m.get_abs_sub() ||
+        threats.field_generation != map::get_field_generation() ) {
+        threats = shared_threats();
+        threats.turn = calendar::turn;
+        threats.abs_sub = g->m.get_abs_sub();
+        threats.field_generation = map::get_field_generation();
+    }
+    return threats;
+}
+
+const std::vector<tripoint> &fires_on_zlevel( const int zlev )
+{
+    auto &fires = get_shared_threats().fires;
+    auto iter = fires.find( zlev );
+    if( iter == fires.end() ) {
+        iter = fires.emplace( zlev, g->m.get_field_locations( fd_fire, zlev ) ).first;
+    }
+    return iter->second;
+}
+
+double shared_weapon_value( const player &u )
+{
+    auto &values = get_shared_threats().weapon_values;
+    const auto iter = values.find( &u );
+    if( iter != values.end() && std::get<0>( iter->second ) == u.weapon.typeId() &&
+        std::get<1>( iter->second ) == u.weapon.charges ) {
+        return std::get<2>( iter->second );
+    }
+    const double value = u.weapon_value( u.weapon );
+    values[&u] = std::make_tuple( u.weapon.typeId(), u.weapon.charges, value );
+    return value;
+}
+
 } // namespace
 
 std::string npc_action_name( npc_action action );
@@ -374,13 +423,12 @@ void npc::assess_danger()
         cur_threat_map[ threat_dir ] = 0.25f * ai_cache.threat_map[ threat_dir ];
     }
     // first, check if we're about to be consumed by fire
-    // TODO: Use the field cache
-    for( const tripoint &pt : g->m.points_in_radius( pos(), 6 ) ) {
-        if( pt == pos() || g->m.has_flag( TFLAG_FIRE_CONTAINER,  pt ) ) {
+    for( const tripoint &pt : fires_on_zlevel( posz() ) ) {
+        const int dist = rl_dist( pos(), pt );
+        if( dist == 0 || dist > 6 || g->m.has_flag( TFLAG_FIRE_CONTAINER,  pt ) ) {
             continue;
         }
         if( g->m.get_field( pt, fd_fire ) != nullptr ) {
-            int dist = rl_dist( pos(), pt );
             cur_threat_map[direction_from( pos(), pt )] += 2.0f * ( NPC_DANGER_MAX - dist );
             if( dist < 3 && !has_effect( effect_npc_fire_bad ) ) {
                 warn_about( "fire_bad", 1_minutes );
@@ -577,7 +625,7 @@ float npc::character_danger( const Character &uc ) const
     float ret = 0.0;
     bool u_gun = u.weapon.is_gun();
     bool my_gun = weapon.is_gun();
-    double u_weap_val = u.weapon_value( u.weapon );
+    double u_weap_val = shared_weapon_value( u );
     const double &my_weap_val = ai_cache.my_weapon_value;
     if( u_gun && !my_gun ) {
         u_weap_val *= 1.5f;
@@ -594,6 +642,20 @@ float npc::character_danger( const Character &uc ) const
     return ret;
 }
 
+// How long a pausing NPC keeps pausing before it thinks about what to do again
+static constexpr time_duration idle_think_interval = 5_turns;
+
+bool npc::think_is_due() const
+{
+    return calendar::turn >= ai_cache.next_think || get_hp() != ai_cache.think_hp ||
+           g->num_creatures() != ai_cache.think_creatures || attitude != ai_cache.think_attitude ||
+           mission != ai_cache.think_mission || !ai_cache.sound_alerts.empty() ||
+           // Camp jobs are handed out on the half hour
+           calendar::once_every( 30_minutes ) ||
+           has_effect( effect_npc_run_away ) || has_effect( effect_npc_fire_bad ) ||
+           ( !in_vehicle && sees_dangerous_field( pos() ) );
+}
+
 void npc::regen_ai_cache()
 {
     auto i = std::begin( ai_cache.sound_alerts );
@@ -622,7 +684,7 @@ void npc::regen_ai_cache()
     ai_cache.can_heal.clear_all();
     ai_cache.danger = 0.0f;
     ai_cache.total_danger = 0.0f;
-    ai_cache.my_weapon_value = weapon_value( weapon );
+    ai_cache.my_weapon_value = shared_weapon_value( *this );
     ai_cache.dangerous_explosives = find_dangerous_explosives();
 
     assess_danger();
@@ -662,6 +724,13 @@ void npc::move()
     } else if( attitude == NPCATT_FLEE_TEMP && !has_effect( effect_npc_flee_player ) ) {
         set_attitude( NPCATT_NULL );
     }
+    if( !think_is_due() ) {
+        adjust_power_cbms();
+        execute_action( npc_pause );
+        return;
+    }
+    // Only set again if the NPC decides to pause
+    ai_cache.next_think = calendar::before_time_starts;
     regen_ai_cache();
     adjust_power_cbms();
     // NPCs under operation should just stay still
@@ -898,6 +967,13 @@ void npc::move()
     }
 
     add_msg( m_debug, "%s chose action %s.", name, npc_action_name( action ) );
+    if( action == npc_pause ) {
+        ai_cache.next_think = calendar::turn + idle_think_interval;
+        ai_cache.think_hp = get_hp();
+        ai_cache.think_creatures = g->num_creatures();
+        ai_cache.think_attitude = attitude;
+        ai_cache.think_mission = mission;
+    }
     execute_action( action );
 }
 
@@ -654,6 +654,8 @@ void npc_chatbin::check_missions()
 
 void npc::talk_to_u( bool text_only, bool radio_contact )
 {
+    // Whatever the player says may change what the NPC should be doing
+    ai_cache.next_think = calendar::before_time_starts;
     if( g->u.is_dead_state() ) {
         set_attitude( NPCATT_NULL );
         return;
@@ -1968,6 +1968,11 @@ void options_manager::add_options_debug()
 
     get_option( "FOV_3D_Z_RANGE" ).setPrerequisite( "FOV_3D" );
 
+    add( "GAS_DIFFUSION", "debug", translate_marker( "Experimental gas diffusion" ),
+         translate_marker( "If true, gases and smoke spread over the whole reality bubble in one step per turn, independent of the order tiles are processed in.  Wind and vertical spreading are ignored.  If false, gas spreads tile by tile." ),
+         false
+       );
+
     add( "ENCODING_CONV", "debug", translate_marker( "Experimental path name encoding conversion" ),
          translate_marker( "If true, file path names are going to be transcoded from system encoding to UTF-8 when reading and will be transcoded back when writing.  Mainly for CJK Windows users." ),
          true
@@ -12,6 +12,8 @@
 #include <stack>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 #include <array>
 #include <memory>
@@ -23,6 +25,7 @@
 #include "color.h"
 #include "cursesdef.h"
 #include "cursesport.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "item.h"
 #include "line.h"
@@ -67,14 +70,55 @@ extern bool use_tiles;
 
 extern bool test_mode;
 
+namespace
+{
+
+/**
+ * Remembers the results of parsing the strings that are drawn over and over, like the lines
+ * of the sidebar and of menus. It forgets everything once it is full, which bounds its memory
+ * without any bookkeeping on lookups.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class text_parse_cache
+{
+    public:
+        template<typename Parse>
+        const Value &get( const Key &key, const Parse &parse ) {
+            const auto iter = entries.find( key );
+            if( iter != entries.end() ) {
+                return iter->second;
+            }
+            if( entries.size() >= max_entries ) {
+                entries.clear();
+            }
+            return entries.emplace( key, parse() ).first->second;
+        }
+        void clear() {
+            entries.clear();
+        }
+    private:
+        static constexpr size_t max_entries = 1024;
+        std::unordered_map<Key, Value, Hash> entries;
+};
+
+// Longer strings are parsed every time, they are rare and would take most of the memory
+constexpr size_t max_cached_text_length = 1024;
+
+using color_tag_cache = text_parse_cache<std::string, std::shared_ptr<const color_tagged_text>>;
+
+} // namespace
+
+static color_tag_cache &get_color_tag_cache()
+{
+    static color_tag_cache cache;
+    return cache;
+}
+
 // utf8 version
-std::vector<std::string> foldstring( const std::string &str, int width, const char split )
+static std::vector<std::string> foldstring_uncached( const std::string &str, int width,
+        const char split )
 {
     std::vector<std::string> lines;
-    if( width < 1 ) {
-        lines.push_back( str );
-        return lines;
-    }
     std::stringstream sstr( str );
     std::string strline;
     std::vector<std::string> tags;
@@ -131,42 +175,88 @@ std::vector<std::string> foldstring( const std::string &str, int width, const ch
     return lines;
 }
 
-std::vector<std::string> split_by_color( const std::string &s )
+std::vector<std::string> foldstring( const std::string &str, int width, const char split )
 {
-    std::vector<std::string> ret;
-    std::vector<size_t> tag_positions = get_tag_positions( s );
+    if( width < 1 ) {
+        return { str };
+    }
+    if( str.size() > max_cached_text_length ) {
+        return foldstring_uncached( str, width, split );
+    }
+    using fold_key = std::tuple<std::string, int, char>;
+    static text_parse_cache<fold_key, std::vector<std::string>, cata::tuple_hash> folded;
+    return folded.get( fold_key( str, width, split ), [&]() {
+        return foldstring_uncached( str, width, split );
+    } );
+}
+
+static color_tagged_text parse_color_tags_uncached( const std::string &s )
+{
+    color_tagged_text result;
+    const std::vector<size_t> tag_positions = get_tag_positions( s );
+
+    const auto add_segment = [&]( const size_t begin, const size_t end ) {
+        color_tagged_text::segment seg;
+        seg.raw = s.substr( begin, end - begin );
+        seg.tag = get_color_from_tag( seg.raw );
+        seg.text = rm_prefix( seg.raw );
+        seg.width = utf8_width( seg.text );
+        result.segments.emplace_back( std::move( seg ) );
+    };
     size_t last_pos = 0;
     for( size_t tag_position : tag_positions ) {
-        ret.push_back( s.substr( last_pos, tag_position - last_pos ) );
+        add_segment( last_pos, tag_position );
         last_pos = tag_position;
     }
     // and the last (or only) one
-    ret.push_back( s.substr( last_pos, std::string::npos ) );
-    return ret;
-}
-
-std::string remove_color_tags( const std::string &s )
-{
-    std::string ret;
-    std::vector<size_t> tag_positions = get_tag_positions( s );
-    size_t next_pos = 0;
+    add_segment( last_pos, s.size() );
 
     if( tag_positions.size() > 1 ) {
+        size_t next_pos = 0;
         for( size_t tag_position : tag_positions ) {
-            ret += s.substr( next_pos, tag_position - next_pos );
+            result.untagged += s.substr( next_pos, tag_position - next_pos );
             next_pos = s.find( ">", tag_position, 1 ) + 1;
         }
-
-        ret += s.substr( next_pos, std::string::npos );
+        result.untagged += s.substr( next_pos, std::string::npos );
     } else {
-        return s;
+        result.untagged = s;
+    }
+    result.width = utf8_width( result.untagged );
+    return result;
+}
+
+std::shared_ptr<const color_tagged_text> parse_color_tags( const std::string &s )
+{
+    if( s.size() > max_cached_text_length ) {
+        return std::make_shared<const color_tagged_text>( parse_color_tags_uncached( s ) );
+    }
+    return get_color_tag_cache().get( s, [&]() {
+        return std::make_shared<const color_tagged_text>( parse_color_tags_uncached( s ) );
+    } );
+}
+
+void clear_color_tag_cache()
+{
+    get_color_tag_cache().clear();
+}
+
+std::vector<std::string> split_by_color( const std::string &s )
+{
+    std::vector<std::string> ret;
+    for( const color_tagged_text::segment &seg : parse_color_tags( s )->segments ) {
+        ret.push_back( seg.raw );
     }
     return ret;
 }
 
-static void update_color_stack( std::stack<nc_color> &color_stack, const std::string &seg )
+std::string remove_color_tags( const std::string &s )
+{
+    return parse_color_tags( s )->untagged;
+}
+
+static void update_color_stack( std::stack<nc_color> &color_stack,
+                                const color_tag_parse_result &tag )
 {
-    color_tag_parse_result tag = get_color_from_tag( seg );
     switch( tag.type ) {
         case color_tag_parse_result::open_color_tag:
             color_stack.push( tag.color );
@@ -188,22 +278,19 @@ void print_colored_text( const catacurses::window &w, const point &p, nc_color &
     if( p.y > -1 && p.x > -1 ) {
         wmove( w, p );
     }
-    const auto color_segments = split_by_color( text );
+    const std::shared_ptr<const color_tagged_text> parsed = parse_color_tags( text );
     std::stack<nc_color> color_stack;
     color_stack.push( color );
 
-    for( auto seg : color_segments ) {
-        if( seg.empty() ) {
+    for( const color_tagged_text::segment &seg : parsed->segments ) {
+        if( seg.raw.empty() ) {
             continue;
         }
 
-        if( seg[0] == '<' ) {
-            update_color_stack( color_stack, seg );
-            seg = rm_prefix( seg );
-        }
+        update_color_stack( color_stack, seg.tag );
 
         color = color_stack.empty() ? base_color : color_stack.top();
-        wprintz( w, color, seg );
+        wprintz( w, color, seg.text );
     }
 }
 
@@ -314,18 +401,15 @@ int fold_and_print_from( const catacurses::window &w, const point &begin, int wi
             wmove( w, begin + point( 0, -begin_line + line_num ) );
         }
         // split into colorable sections
-        std::vector<std::string> color_segments = split_by_color( textformatted[line_num] );
+        const std::shared_ptr<const color_tagged_text> parsed =
+            parse_color_tags( textformatted[line_num] );
         // for each section, get the color, and print it
-        std::vector<std::string>::iterator it;
-        for( it = color_segments.begin(); it != color_segments.end(); ++it ) {
-            if( !it->empty() && it->at( 0 ) == '<' ) {
-                update_color_stack( color_stack, *it );
-            }
+        for( const color_tagged_text::segment &seg : parsed->segments ) {
+            update_color_stack( color_stack, seg.tag );
             if( line_num >= begin_line ) {
-                std::string l = rm_prefix( *it );
-                if( l != "--" ) { // -- is a separation line!
+                if( seg.text != "--" ) { // -- is a separation line!
                     nc_color color = color_stack.empty() ? base_color : color_stack.top();
-                    wprintz( w, color, rm_prefix( *it ) );
+                    wprintz( w, color, seg.text );
                 } else {
                     for( int i = 0; i < width; i++ ) {
                         wputch( w, c_dark_gray, LINE_OXOX );
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <iterator>
 #include <locale>
+#include <memory>
 #include <utility>
 
 #include "catacharset.h"
@@ -372,6 +373,34 @@ std::string word_rewrap( const std::string &ins, int width, uint32_t split = ' '
 std::vector<size_t> get_tag_positions( const std::string &s );
 std::vector<std::string> split_by_color( const std::string &s );
 
+/** A string split at its @ref color_tags, see @ref parse_color_tags. */
+struct color_tagged_text {
+    struct segment {
+        // The segment as @ref split_by_color returns it, starting with its tag if it has one
+        std::string raw;
+        // The segment without its tag
+        std::string text;
+        color_tag_parse_result tag;
+        // Width of text in console cells
+        int width;
+    };
+    std::vector<segment> segments;
+    // The string as @ref remove_color_tags returns it
+    std::string untagged;
+    // Width of untagged in console cells
+    int width;
+};
+
+/**
+ * Splits the string at its color tags and measures the pieces. The same lines of the sidebar
+ * and of menus are drawn again on every input, so the results are cached. The cache only
+ * takes strings of moderate length and forgets everything once it is full, which bounds
+ * its memory.
+ */
+std::shared_ptr<const color_tagged_text> parse_color_tags( const std::string &s );
+/** Forgets the parsed tags, e.g. after the colors they name have been redefined. */
+void clear_color_tag_cache();
+
 bool query_yn( const std::string &text );
 template<typename ...Args>
 inline bool query_yn( const char *const msg, Args &&... args )
@@ -5,6 +5,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <iterator>
 #include <numeric>
 #include <ostream>
 #include <queue>
@@ -1076,6 +1077,12 @@ void overmap::populate( overmap_special_batch &enabled_specials )
 }
 
 void overmap::populate()
+{
+    overmap_special_batch enabled_specials = get_enabled_specials();
+    populate( enabled_specials );
+}
+
+overmap_special_batch overmap::get_enabled_specials() const
 {
     overmap_special_batch enabled_specials = overmap_specials::get_default_batch( loc );
 
@@ -1119,7 +1126,7 @@ void overmap::populate()
         }
     }
 
-    populate( enabled_specials );
+    return enabled_specials;
 }
 
 oter_id overmap::get_default_terrain( int z ) const
@@ -1147,6 +1154,7 @@ void overmap::init_layers()
                 layer[k].explored[i][j] = false;
             }
         }
+        touch_layer( k - OVERMAP_DEPTH );
     }
 }
 
@@ -1157,7 +1165,11 @@ void overmap::ter_set( const tripoint &p, const oter_id &id )
         return;
     }
 
-    layer[p.z + OVERMAP_DEPTH].terrain[p.x][p.y] = id;
+    oter_id &terrain = layer[p.z + OVERMAP_DEPTH].terrain[p.x][p.y];
+    if( terrain != id ) {
+        terrain = id;
+        touch_layer( p.z );
+    }
 }
 
 const oter_id &overmap::ter( const tripoint &p ) const
@@ -1170,38 +1182,54 @@ const oter_id &overmap::ter( const tripoint &p ) const
     return layer[p.z + OVERMAP_DEPTH].terrain[p.x][p.y];
 }
 
-bool &overmap::seen( const tripoint &p )
+bool overmap::seen( const tripoint &p ) const
 {
     if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
+        return false;
     }
     return layer[p.z + OVERMAP_DEPTH].visible[p.x][p.y];
 }
 
-bool overmap::seen( const tripoint &p ) const
+void overmap::set_seen( const tripoint &p, const bool seen )
 {
     if( !inbounds( p ) ) {
-        return false;
+        return;
+    }
+    bool &visible = layer[p.z + OVERMAP_DEPTH].visible[p.x][p.y];
+    if( visible != seen ) {
+        visible = seen;
+        touch_layer( p.z );
     }
-    return layer[p.z + OVERMAP_DEPTH].visible[p.x][p.y];
 }
 
-bool &overmap::explored( const tripoint &p )
+bool overmap::is_explored( const tripoint &p ) const
 {
     if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
+        return false;
     }
     return layer[p.z + OVERMAP_DEPTH].explored[p.x][p.y];
 }
 
-bool overmap::is_explored( const tripoint &p ) const
+void overmap::set_explored( const tripoint &p, const bool explored )
 {
     if( !inbounds( p ) ) {
-        return false;
+        return;
     }
-    return layer[p.z + OVERMAP_DEPTH].explored[p.x][p.y];
+    layer[p.z + OVERMAP_DEPTH].explored[p.x][p.y] = explored;
+    touch_layer( p.z );
+}
+
+int overmap::get_layer_generation( const int z ) const
+{
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return 0;
+    }
+    return layer[z + OVERMAP_DEPTH].generation;
+}
+
+void overmap::touch_layer( const int z )
+{
+    layer[z + OVERMAP_DEPTH].generation = ++last_layer_generation;
 }
 
 bool overmap::mongroup_check( const mongroup &candidate ) const
@@ -1279,6 +1307,15 @@ bool overmap::has_note( const tripoint &p ) const
     return false;
 }
 
+const std::vector<om_note> &overmap::get_notes( const int z ) const
+{
+    static const std::vector<om_note> fallback;
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return fallback;
+    }
+    return layer[z + OVERMAP_DEPTH].notes;
+}
+
 bool overmap::is_marked_dangerous( const tripoint &p ) const
 {
     for( auto &i : layer[p.z + OVERMAP_DEPTH].notes ) {
@@ -1338,6 +1375,7 @@ void overmap::add_note( const tripoint &p, std::string message )
     } else {
         notes.erase( it );
     }
+    touch_layer( p.z );
 }
 
 void overmap::mark_note_dangerous( const tripoint &p, int radius, bool is_dangerous )
@@ -1346,6 +1384,7 @@ void overmap::mark_note_dangerous( const tripoint &p, int radius, bool is_danger
         if( p.xy() == i.p ) {
             i.dangerous = is_dangerous;
             i.danger_radius = radius;
+            touch_layer( p.z );
             return;
         }
     }
@@ -1419,6 +1458,7 @@ void overmap::add_extra( const tripoint &p, const string_id<map_extra> &id )
     } else {
         extras.erase( it );
     }
+    touch_layer( p.z );
 }
 
 void overmap::delete_extra( const tripoint &p )
@@ -1478,34 +1518,56 @@ void overmap::generate( const overmap *north, const overmap *east,
 
     dbg( D_INFO ) << "overmap::generate start…";
 
-    populate_connections_out_from_neighbors( north, east, south, west );
+    for( int stage = 0; !generate_stage( stage, north, east, south, west, enabled_specials );
+         stage++ ) {
+    }
 
-    place_rivers( north, east, south, west );
-    place_lakes();
-    place_forests();
-    place_swamps();
-    place_cities();
-    place_forest_trails();
-    place_roads( north, east, south, west );
-    place_specials( enabled_specials );
-    place_forest_trailheads();
+    dbg( D_INFO ) << "overmap::generate done";
+}
 
-    polish_river();
+bool overmap::generate_stage( const int stage, const overmap *north, const overmap *east,
+                              const overmap *south, const overmap *west,
+                              overmap_special_batch &enabled_specials )
+{
+    switch( stage ) {
+        case 0:
+            populate_connections_out_from_neighbors( north, east, south, west );
+            place_rivers( north, east, south, west );
+            place_lakes();
+            return false;
+        case 1:
+            place_forests();
+            place_swamps();
+            return false;
+        case 2:
+            place_cities();
+            place_forest_trails();
+            return false;
+        case 3:
+            place_roads( north, east, south, west );
+            return false;
+        case 4:
+            place_specials( enabled_specials );
+            place_forest_trailheads();
+            polish_river();
+            return false;
+        default:
+            break;
+    }
 
     // TODO: there is no reason we can't generate the sublevels in one pass
     //       for that matter there is no reason we can't as we add the entrance ways either
 
-    // Always need at least one sublevel, but how many more
-    int z = -1;
-    bool requires_sub = false;
-    do {
-        requires_sub = generate_sub( z );
-    } while( requires_sub && ( --z >= -OVERMAP_DEPTH ) );
+    // Always need at least one sublevel, but how many more, one per stage
+    const int z = 4 - stage;
+    if( generate_sub( z ) && z > -OVERMAP_DEPTH ) {
+        return false;
+    }
 
     // Place the monsters, now that the terrain is laid out
     place_mongroups();
     place_radios();
-    dbg( D_INFO ) << "overmap::generate done";
+    return true;
 }
 
 bool overmap::generate_sub( const int z )
@@ -1962,15 +2024,16 @@ void overmap::move_hordes()
                 mg.pos.y++;
             }
 
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.insert( std::pair<tripoint, mongroup>( mg.pos, mg ) );
+            // Erase the group at it's old location, add the group with the new location.
+            // Move it, copying the monsters of large hordes is expensive.
+            tmpzg.emplace( mg.pos, std::move( mg ) );
             zg.erase( it++ );
         } else {
             ++it;
         }
     }
     // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    zg.insert( std::make_move_iterator( tmpzg.begin() ), std::make_move_iterator( tmpzg.end() ) );
 
     if( get_option<bool>( "WANDER_SPAWNS" ) ) {
 
@@ -2048,36 +2111,59 @@ void overmap::move_hordes()
 */
 void overmap::signal_hordes( const tripoint &p, const int sig_power )
 {
+    signal_hordes( { { p, sig_power } } );
+}
+
+/**
+* Applies a signal to a single horde that is within its range.
+* @param dist distance between the horde and the signal
+*/
+static void signal_horde( mongroup &mg, const tripoint &p, const int sig_power, const int dist )
+{
+    // TODO: base this in monster attributes, foremost GOODHEARING.
+    const int inter_per_sig_power = 15; //Interest per signal value
+    const int min_initial_inter = 30; //Min initial interest for horde
+    const int calculated_inter = ( sig_power + 1 - dist ) * inter_per_sig_power; // Calculated interest
+    const int roll = rng( 0, mg.interest );
+    // Minimum capped calculated interest. Used to give horde enough interest to really investigate the target at start.
+    const int min_capped_inter = std::max( min_initial_inter, calculated_inter );
+    if( roll < min_capped_inter ) { //Rolling if horde interested in new signal
+        // TODO: Z-coordinate for mongroup targets
+        const int targ_dist = rl_dist( p, mg.target );
+        // TODO: Base this on targ_dist:dist ratio.
+        if( targ_dist < 5 ) {  // If signal source already pursued by horde
+            mg.set_target( ( mg.target.x + p.x ) / 2, ( mg.target.y + p.y ) / 2 );
+            const int min_inc_inter = 3; // Min interest increase to already targeted source
+            const int inc_roll = rng( min_inc_inter, calculated_inter );
+            mg.inc_interest( inc_roll );
+            add_msg( m_debug, "horde inc interest %d dist %d", inc_roll, dist );
+        } else { // New signal source
+            mg.set_target( p.x, p.y );
+            mg.set_interest( min_capped_inter );
+            add_msg( m_debug, "horde set interest %d dist %d", min_capped_inter, dist );
+        }
+    }
+}
+
+void overmap::signal_hordes( const std::vector<std::pair<tripoint, int>> &signals )
+{
+    // Gather the hordes once into flat arrays, so each signal only has to scan
+    // the positions instead of walking all monster groups again.
+    std::vector<mongroup *> hordes;
+    std::vector<tripoint> horde_positions;
     for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
-        if( !mg.horde ) {
-            continue;
-        }
-        const int dist = rl_dist( p, mg.pos );
-        if( sig_power < dist ) {
-            continue;
-        }
-        // TODO: base this in monster attributes, foremost GOODHEARING.
-        const int inter_per_sig_power = 15; //Interest per signal value
-        const int min_initial_inter = 30; //Min initial interest for horde
-        const int calculated_inter = ( sig_power + 1 - dist ) * inter_per_sig_power; // Calculated interest
-        const int roll = rng( 0, mg.interest );
-        // Minimum capped calculated interest. Used to give horde enough interest to really investigate the target at start.
-        const int min_capped_inter = std::max( min_initial_inter, calculated_inter );
-        if( roll < min_capped_inter ) { //Rolling if horde interested in new signal
-            // TODO: Z-coordinate for mongroup targets
-            const int targ_dist = rl_dist( p, mg.target );
-            // TODO: Base this on targ_dist:dist ratio.
-            if( targ_dist < 5 ) {  // If signal source already pursued by horde
-                mg.set_target( ( mg.target.x + p.x ) / 2, ( mg.target.y + p.y ) / 2 );
-                const int min_inc_inter = 3; // Min interest increase to already targeted source
-                const int inc_roll = rng( min_inc_inter, calculated_inter );
-                mg.inc_interest( inc_roll );
-                add_msg( m_debug, "horde inc interest %d dist %d", inc_roll, dist );
-            } else { // New signal source
-                mg.set_target( p.x, p.y );
-                mg.set_interest( min_capped_inter );
-                add_msg( m_debug, "horde set interest %d dist %d", min_capped_inter, dist );
+        if( elem.second.horde ) {
+            hordes.push_back( &elem.second );
+            horde_positions.push_back( elem.second.pos );
+        }
+    }
+    for( const std::pair<tripoint, int> &signal : signals ) {
+        const tripoint &p = signal.first;
+        const int sig_power = signal.second;
+        for( size_t i = 0; i < horde_positions.size(); i++ ) {
+            const int dist = rl_dist( p, horde_positions[i] );
+            if( sig_power >= dist ) {
+                signal_horde( *hordes[i], p, sig_power, dist );
             }
         }
     }
@@ -4347,6 +4433,9 @@ void overmap::open( overmap_special_batch &enabled_specials )
     if( read_from_file_optional( terfilename, std::bind( &overmap::unserialize, this, _1 ) ) ) {
         const std::string plrfilename = overmapbuffer::player_filename( loc );
         read_from_file_optional( plrfilename, std::bind( &overmap::unserialize_view, this, _1 ) );
+        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+            touch_layer( z );
+        }
     } else { // No map exists!  Prepare neighbors, and generate one.
         std::vector<const overmap *> pointers;
         // Fetch south and north
@@ -4536,6 +4625,8 @@ std::string enum_to_string<ot_match_type>( ot_match_type data )
 
 constexpr tripoint overmap::invalid_tripoint;
 
+int overmap::last_layer_generation = 0;
+
 std::string oter_no_dir( const oter_id &oter )
 {
     std::string base_oter_id = oter.id().c_str();
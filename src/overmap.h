@@ -103,6 +103,8 @@ struct map_layer {
     bool explored[OMAPX][OMAPY];
     std::vector<om_note> notes;
     std::vector<om_map_extra> extras;
+    // Changes whenever the terrain, seen or explored state, notes or extras of the layer change
+    int generation = 0;
 };
 
 struct om_special_sectors {
@@ -229,12 +231,20 @@ class overmap
 
         void ter_set( const tripoint &p, const oter_id &id );
         const oter_id &ter( const tripoint &p ) const;
-        bool &seen( const tripoint &p );
         bool seen( const tripoint &p ) const;
-        bool &explored( const tripoint &p );
+        void set_seen( const tripoint &p, bool seen );
         bool is_explored( const tripoint &p ) const;
+        void set_explored( const tripoint &p, bool explored );
+        /**
+         * Returns a value that changes whenever anything the player knows about the
+         * z-level changes: its terrain, seen or explored state, notes and extras.
+         * The values are unique across all overmaps.
+         */
+        int get_layer_generation( int z ) const;
 
         bool has_note( const tripoint &p ) const;
+        /** Returns the notes of the z-level, in local coordinates. */
+        const std::vector<om_note> &get_notes( int z ) const;
         bool is_marked_dangerous( const tripoint &p ) const;
         const std::string &note( const tripoint &p ) const;
         void add_note( const tripoint &p, std::string message );
@@ -340,7 +350,6 @@ class overmap
 
         std::vector<shared_ptr_fast<npc>> npcs;
 
-        bool nullbool = false;
         point loc = point_zero;
 
         std::array<map_layer, OVERMAP_LAYERS> layer;
@@ -357,6 +366,9 @@ class overmap
 
         // Initialize
         void init_layers();
+        // Gives the layer of z-level z a new generation
+        void touch_layer( int z );
+        static int last_layer_generation;
         // open existing overmap, or generate a new one
         void open( overmap_special_batch &enabled_specials );
     public:
@@ -381,11 +393,23 @@ class overmap
         void generate( const overmap *north, const overmap *east,
                        const overmap *south, const overmap *west,
                        overmap_special_batch &enabled_specials );
+        /**
+         * Runs one stage of @ref generate, stages must be run in order starting at 0.
+         * Each sublevel is a stage of its own, so the number of stages varies.
+         * @returns whether the overmap is complete after this stage.
+         */
+        bool generate_stage( int stage, const overmap *north, const overmap *east,
+                             const overmap *south, const overmap *west,
+                             overmap_special_batch &enabled_specials );
         bool generate_sub( int z );
+        // The default specials, filtered by the region's blacklist and whitelist
+        overmap_special_batch get_enabled_specials() const;
 
         const city &get_nearest_city( const tripoint &p ) const;
 
         void signal_hordes( const tripoint &p, int sig_power );
+        /** Same as above for many signals (position, power) at once. */
+        void signal_hordes( const std::vector<std::pair<tripoint, int>> &signals );
         void process_mongroups();
         void move_hordes();
 
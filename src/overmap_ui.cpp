@@ -458,6 +458,144 @@ static point draw_notes( const tripoint &origin )
     return result;
 }
 
+// What the player knows about an overmap cell: everything drawn below the moving entities
+// and the debug overlays.
+struct seen_cell {
+    bool valid = false;
+    bool see = false;
+    oter_id ter = oter_str_id::NULL_ID();
+    std::string sym = " ";
+    nc_color color = c_black;
+    bool has_note = false;
+    char note_sym = ' ';
+    nc_color note_color = c_black;
+};
+
+// Draw settings that change the contents of the seen cells
+struct seen_cell_options {
+    bool debug_vision = false;
+    bool show_explored = false;
+    bool land_use_codes = false;
+    bool forest_trails = false;
+
+    bool operator==( const seen_cell_options &rhs ) const {
+        return debug_vision == rhs.debug_vision && show_explored == rhs.show_explored &&
+               land_use_codes == rhs.land_use_codes && forest_trails == rhs.forest_trails;
+    }
+    bool operator!=( const seen_cell_options &rhs ) const {
+        return !( *this == rhs );
+    }
+};
+
+/**
+ * The seen cells of the overmaps in view, kept between frames so that scrolling over explored
+ * areas doesn't query the overmaps and search their notes for every cell again.
+ * The cells of a z-level of an overmap are filled in as they come into view, and are dropped
+ * when the generation of that layer changes (see @ref overmap::get_layer_generation).
+ */
+class seen_raster
+{
+    public:
+        const seen_cell &get( const tripoint &omp, const seen_cell_options &opts );
+        void clear() {
+            layers.clear();
+        }
+    private:
+        struct layer_cells {
+            int generation = 0;
+            std::vector<seen_cell> cells;
+        };
+
+        void fill( seen_cell &cell, const overmap &om, const tripoint &local ) const;
+
+        // Each layer takes OMAPX * OMAPY cells, more than a screen ever shows at once
+        static constexpr size_t max_layers = 16;
+
+        std::unordered_map<tripoint, layer_cells> layers;
+        seen_cell_options options;
+};
+
+static seen_raster &get_seen_raster()
+{
+    static seen_raster raster;
+    return raster;
+}
+
+const seen_cell &seen_raster::get( const tripoint &omp, const seen_cell_options &opts )
+{
+    static const seen_cell unknown;
+    if( opts != options ) {
+        layers.clear();
+        options = opts;
+    }
+    if( omp.z < -OVERMAP_DEPTH || omp.z > OVERMAP_HEIGHT ) {
+        return unknown;
+    }
+
+    point local = omp.xy();
+    const point om_pos = omt_to_om_remain( local );
+    // Debug vision sees everything, even overmaps that haven't been generated yet
+    const overmap *om = options.debug_vision ? &overmap_buffer.get( om_pos ) :
+                        overmap_buffer.get_existing( om_pos );
+    if( om == nullptr ) {
+        return unknown;
+    }
+
+    const tripoint key( om_pos, omp.z );
+    auto iter = layers.find( key );
+    if( iter == layers.end() ) {
+        if( layers.size() >= max_layers ) {
+            layers.clear();
+        }
+        iter = layers.emplace( key, layer_cells() ).first;
+    }
+    layer_cells &layer = iter->second;
+    const int generation = om->get_layer_generation( omp.z );
+    if( layer.cells.empty() || layer.generation != generation ) {
+        layer.generation = generation;
+        layer.cells.assign( OMAPX * OMAPY, seen_cell() );
+        // Place all notes at once instead of searching them for every cell
+        for( const om_note &note : om->get_notes( omp.z ) ) {
+            if( !overmap::inbounds( note.p ) ) {
+                continue;
+            }
+            seen_cell &cell = layer.cells[note.p.y * OMAPX + note.p.x];
+            cell.has_note = true;
+            std::tie( cell.note_sym, cell.note_color, std::ignore ) =
+                get_note_display_info( note.text );
+        }
+    }
+
+    seen_cell &cell = layer.cells[local.y * OMAPX + local.x];
+    if( !cell.valid ) {
+        fill( cell, *om, tripoint( local, omp.z ) );
+    }
+    return cell;
+}
+
+void seen_raster::fill( seen_cell &cell, const overmap &om, const tripoint &local ) const
+{
+    cell.valid = true;
+    cell.see = options.debug_vision || om.seen( local );
+    if( !cell.see ) {
+        return;
+    }
+    // Only load terrain if we can actually see it
+    cell.ter = om.ter( local );
+
+    oter_id shown = cell.ter;
+    if( !options.forest_trails && cell.ter &&
+        is_ot_match( "forest_trail", cell.ter, ot_match_type::type ) ) {
+        // If forest trails shouldn't be displayed, and this is a forest trail, then
+        // instead render it like a forest.
+        shown = oter_str_id( "forest" ).id();
+    }
+    const oter_t &info = shown.obj();
+    const bool explored = options.show_explored && om.is_explored( local );
+    cell.color = explored ? c_dark_gray : info.get_color( options.land_use_codes );
+    cell.sym = info.get_symbol( options.land_use_codes );
+}
+
 void draw( const catacurses::window &w, const catacurses::window &wbar, const tripoint &center,
            const tripoint &orig, bool blink, bool show_explored, bool fast_scroll, input_context *inp_ctxt,
            const draw_data_t &data )
@@ -483,7 +621,12 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
     // Whether showing hordes is currently enabled
     const bool showhordes = uistate.overmap_show_hordes;
 
-    const oter_id forest = oter_str_id( "forest" ).id();
+    seen_cell_options seen_options;
+    seen_options.debug_vision = has_debug_vision;
+    seen_options.show_explored = show_explored;
+    seen_options.land_use_codes = uistate.overmap_show_land_use_codes;
+    seen_options.forest_trails = uistate.overmap_show_forest_trails;
+    seen_raster &raster = get_seen_raster();
 
     std::string sZoneName;
     tripoint tripointZone = tripoint( -1, -1, -1 );
@@ -508,36 +651,6 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         }
     }
 
-    // A small LRU cache: most oter_id's occur in clumps like forests of swamps.
-    // This cache helps avoid much more costly lookups in the full hashmap.
-    constexpr size_t cache_size = 8; // used below to calculate the next index
-    std::array<std::pair<oter_id, oter_t const *>, cache_size> cache {{}};
-    size_t cache_next = 0;
-
-    const auto set_color_and_symbol = [&]( const oter_id & cur_ter, const tripoint & omp,
-    std::string & ter_sym, nc_color & ter_color ) {
-        // First see if we have the oter_t cached
-        oter_t const *info = nullptr;
-        for( const auto &c : cache ) {
-            if( c.first == cur_ter ) {
-                info = c.second;
-                break;
-            }
-        }
-        // Nope, look in the hash map next
-        if( !info ) {
-            info = &cur_ter.obj();
-            cache[cache_next] = std::make_pair( cur_ter, info );
-            cache_next = ( cache_next + 1 ) % cache_size;
-        }
-        // Ok, we found something
-        if( info ) {
-            const bool explored = show_explored && overmap_buffer.is_explored( omp );
-            ter_color = explored ? c_dark_gray : info->get_color( uistate.overmap_show_land_use_codes );
-            ter_sym = info->get_symbol( uistate.overmap_show_land_use_codes );
-        }
-    };
-
     const tripoint corner = center - point( om_half_width, om_half_height );
 
     // For use with place_special: cache the color and symbol of each submap
@@ -643,16 +756,14 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         for( int j = 0; j < om_map_height; ++j ) {
             const tripoint omp = corner + point( i, j );
 
-            oter_id cur_ter = oter_str_id::NULL_ID();
+            // What the player knows about the cell comes from the raster, only the moving
+            // entities and overlays below are looked up every frame
+            const seen_cell &cell = raster.get( omp, seen_options );
+            const bool see = cell.see;
+            const oter_id cur_ter = cell.ter;
             nc_color ter_color = c_black;
             std::string ter_sym = " ";
 
-            const bool see = has_debug_vision || overmap_buffer.seen( omp );
-            if( see ) {
-                // Only load terrain if we can actually see it
-                cur_ter = overmap_buffer.ter( omp );
-            }
-
             // Check if location is within player line-of-sight
             const bool los = see && g->u.overmap_los( omp, sight_points );
             const bool los_sky = g->u.overmap_los( omp, sight_points * 2 );
@@ -681,10 +792,10 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                 } else if( target.z < center.z ) {
                     ter_sym = "v";
                 }
-            } else if( blink && uistate.overmap_show_map_notes && overmap_buffer.has_note( omp ) ) {
+            } else if( blink && uistate.overmap_show_map_notes && cell.has_note ) {
                 // Display notes in all situations, even when not seen
-                std::tie( ter_sym, ter_color, std::ignore ) =
-                    get_note_display_info( overmap_buffer.note( omp ) );
+                ter_sym = cell.note_sym;
+                ter_color = cell.note_color;
             } else if( !see ) {
                 // All cases above ignore the seen-status,
                 ter_color = c_dark_gray;
@@ -712,14 +823,10 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
             } else if( !sZoneName.empty() && tripointZone.xy() == omp.xy() ) {
                 ter_color = c_yellow;
                 ter_sym   = "Z";
-            } else if( !uistate.overmap_show_forest_trails && cur_ter &&
-                       is_ot_match( "forest_trail", cur_ter, ot_match_type::type ) ) {
-                // If forest trails shouldn't be displayed, and this is a forest trail, then
-                // instead render it like a forest.
-                set_color_and_symbol( forest, omp, ter_sym, ter_color );
             } else {
                 // Nothing special, but is visible to the player.
-                set_color_and_symbol( cur_ter, omp, ter_sym, ter_color );
+                ter_sym = cell.sym;
+                ter_color = cell.color;
             }
 
             // Are we debugging monster groups?
@@ -1564,6 +1671,8 @@ static tripoint display( const tripoint &orig, const draw_data_t &data = draw_da
             last_blink = now;
         }
     } while( action != "QUIT" && action != "CONFIRM" );
+    // The player will have moved or learned something by the next time the map is opened
+    get_seen_raster().clear();
     werase( g->w_overmap );
     werase( g->w_omlegend );
     catacurses::erase();
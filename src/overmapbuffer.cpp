@@ -81,6 +81,10 @@ overmap &overmapbuffer::get( const point &p )
         return *( last_requested_overmap = it->second.get() );
     }
 
+    if( pregenerating != nullptr && pregenerating->pos() == p ) {
+        return finish_pregenerating();
+    }
+
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     new_om.populate();
@@ -95,6 +99,9 @@ overmap &overmapbuffer::get( const point &p )
 
 void overmapbuffer::create_custom_overmap( const point &p, overmap_special_batch &specials )
 {
+    if( pregenerating != nullptr && pregenerating->pos() == p ) {
+        pregenerating.reset();
+    }
     if( last_requested_overmap != nullptr ) {
         auto om_iter = overmaps.find( p );
         if( om_iter != overmaps.end() && om_iter->second.get() == last_requested_overmap ) {
@@ -199,6 +206,7 @@ void overmapbuffer::clear()
     overmaps.clear();
     known_non_existing.clear();
     last_requested_overmap = nullptr;
+    pregenerating.reset();
 }
 
 const regional_settings &overmapbuffer::get_settings( const tripoint &p )
@@ -375,7 +383,7 @@ bool overmapbuffer::is_explored( const tripoint &p )
 void overmapbuffer::toggle_explored( const tripoint &p )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->explored( om_loc.local ) = !om_loc.om->explored( om_loc.local );
+    om_loc.om->set_explored( om_loc.local, !om_loc.om->is_explored( om_loc.local ) );
 }
 
 bool overmapbuffer::has_horde( const tripoint &p )
@@ -479,6 +487,30 @@ void overmapbuffer::signal_hordes( const tripoint &center, const int sig_power )
     }
 }
 
+void overmapbuffer::signal_hordes( const std::vector<std::pair<tripoint, int>> &signals )
+{
+    // Kept in the order the overmaps are first seen, so the rng calls of the hordes happen
+    // in the same order every time.
+    std::vector<std::pair<overmap *, std::vector<std::pair<tripoint, int>>>> signals_per_overmap;
+    for( const std::pair<tripoint, int> &signal : signals ) {
+        for( auto &om : get_overmaps_near( signal.first, signal.second ) ) {
+            auto iter = std::find_if( signals_per_overmap.begin(), signals_per_overmap.end(),
+            [om]( const std::pair<overmap *, std::vector<std::pair<tripoint, int>>> &e ) {
+                return e.first == om;
+            } );
+            if( iter == signals_per_overmap.end() ) {
+                iter = signals_per_overmap.emplace( signals_per_overmap.end(), om,
+                                                    std::vector<std::pair<tripoint, int>>() );
+            }
+            const point abs_pos_om = om_to_sm_copy( om->pos() );
+            iter->second.emplace_back( -abs_pos_om + signal.first, signal.second );
+        }
+    }
+    for( auto &om_signals : signals_per_overmap ) {
+        om_signals.first->signal_hordes( om_signals.second );
+    }
+}
+
 void overmapbuffer::process_mongroups()
 {
     // arbitrary radius to include nearby overmaps (aside from the current one)
@@ -499,6 +531,99 @@ void overmapbuffer::move_hordes()
     }
 }
 
+bool overmapbuffer::pregenerate_near( const tripoint &p )
+{
+    // How close to the border of the current overmap (in overmap terrain) the next one is prepared.
+    static constexpr int pregenerate_distance = OMAPX / 6;
+
+    point local = p.xy();
+    const point om_pos = omt_to_om_remain( local );
+    const int dx = local.x < pregenerate_distance ? -1 :
+                   local.x >= OMAPX - pregenerate_distance ? 1 : 0;
+    const int dy = local.y < pregenerate_distance ? -1 :
+                   local.y >= OMAPY - pregenerate_distance ? 1 : 0;
+    for( const point &offset : {
+             point( dx, 0 ), point( 0, dy ), point( dx, dy )
+         } ) {
+        const point target = om_pos + offset;
+        if( offset == point_zero || has( target ) ) {
+            continue;
+        }
+        if( g->gametype() == SGAME_DEFENSE || file_exist( terrain_filename( target ) ) ) {
+            // Nothing to generate, loading it is cheap enough.
+            get( target );
+            return true;
+        }
+        if( pregenerating == nullptr || pregenerating->pos() != target ) {
+            pregenerating = std::make_unique<overmap>( target );
+            pregenerating_specials = std::make_unique<overmap_special_batch>(
+                                         pregenerating->get_enabled_specials() );
+            pregenerating_stage = 0;
+        }
+        pregenerate_stage();
+        return true;
+    }
+    return false;
+}
+
+std::array<const overmap *, 4> overmapbuffer::get_existing_neighbors( const point &p )
+{
+    return { {
+            get_existing( p + point_north ), get_existing( p + point_east ),
+            get_existing( p + point_south ), get_existing( p + point_west )
+        }
+    };
+}
+
+void overmapbuffer::pregenerate_stage()
+{
+    const point p = pregenerating->pos();
+    // Looking the neighbors up may load other overmaps, which may need this one finished.
+    const std::array<const overmap *, 4> neighbors = get_existing_neighbors( p );
+    if( pregenerating == nullptr || pregenerating->pos() != p ) {
+        return;
+    }
+    std::array<bool, 4> existing;
+    std::transform( neighbors.begin(), neighbors.end(), existing.begin(),
+    []( const overmap * om ) {
+        return om != nullptr;
+    } );
+    if( pregenerating_stage == 0 ) {
+        pregenerating_neighbors = existing;
+    } else if( existing != pregenerating_neighbors ) {
+        // A neighbor was created in the meantime, the earlier stages didn't connect to it.
+        pregenerating = std::make_unique<overmap>( p );
+        pregenerating_stage = 0;
+        pregenerating_neighbors = existing;
+    }
+    if( !pregenerating->generate_stage( pregenerating_stage++, neighbors[0], neighbors[1],
+                                        neighbors[2], neighbors[3], *pregenerating_specials ) ) {
+        return;
+    }
+    overmap &new_om = *( overmaps[ p ] = std::move( pregenerating ) );
+    pregenerating_specials.reset();
+    fix_mongroups( new_om );
+    fix_npcs( new_om );
+}
+
+overmap &overmapbuffer::finish_pregenerating()
+{
+    const point p = pregenerating->pos();
+    const std::unique_ptr<overmap_special_batch> specials = std::move( pregenerating_specials );
+    // Overmaps loaded while finishing it must find it in overmaps, like when it's generated
+    // in one go.
+    overmap &new_om = *( overmaps[ p ] = std::move( pregenerating ) );
+    const std::array<const overmap *, 4> neighbors = get_existing_neighbors( p );
+    while( !new_om.generate_stage( pregenerating_stage++, neighbors[0], neighbors[1],
+                                   neighbors[2], neighbors[3], *specials ) ) {
+    }
+    fix_mongroups( new_om );
+    fix_npcs( new_om );
+
+    last_requested_overmap = &new_om;
+    return new_om;
+}
+
 std::vector<mongroup *> overmapbuffer::monsters_at( const tripoint &p )
 {
     // (x,y) are overmap terrain coordinates, they spawn 2x2 submaps,
@@ -631,7 +756,7 @@ bool overmapbuffer::seen( const tripoint &p )
 void overmapbuffer::set_seen( const tripoint &p, bool seen )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->seen( om_loc.local ) = seen;
+    om_loc.om->set_seen( om_loc.local, seen );
 }
 
 const oter_id &overmapbuffer::ter( const tripoint &p )
@@ -381,6 +381,11 @@ class overmapbuffer
          * @param sig_power The signal strength, higher values means it visible farther away.
          */
         void signal_hordes( const tripoint &center, int sig_power );
+        /**
+         * Same as above for many signals at once, each given as (center, sig_power).
+         * Each overmap is only processed once for all the signals that reach it.
+         */
+        void signal_hordes( const std::vector<std::pair<tripoint, int>> &signals );
         /**
          * Process nearby monstergroups (dying mostly).
          */
@@ -390,6 +395,17 @@ class overmapbuffer
          * therefore you should probably call @ref map::spawn_monsters to spawn them.
          */
         void move_hordes();
+        /**
+         * Loads or generates the overmaps next to the one containing the given point
+         * if the point is close to their border, so the player doesn't have to wait for
+         * them when crossing it. Generation is spread over several calls, each one runs a
+         * single stage of it, the overmap only becomes available once it is complete.
+         * Neighbors sharing a border with the current overmap go before the diagonal one,
+         * so it can connect its rivers and roads to them like regular generation does.
+         * @param p Global overmap terrain coordinates.
+         * @returns whether an overmap was loaded or a generation stage was run.
+         */
+        bool pregenerate_near( const tripoint &p );
         // hordes -- this uses overmap terrain coordinates!
         std::vector<mongroup *> monsters_at( const tripoint &p );
         /**
@@ -482,6 +498,23 @@ class overmapbuffer
         // Cached result of previous call to overmapbuffer::get_existing
         overmap mutable *last_requested_overmap;
 
+        // The overmap @ref pregenerate_near is working on, it isn't in overmaps until complete.
+        std::unique_ptr<overmap> pregenerating;
+        std::unique_ptr<overmap_special_batch> pregenerating_specials;
+        // The next generation stage to run on it.
+        int pregenerating_stage = 0;
+        // Which of its neighbors (north, east, south, west) existed when it was started.
+        std::array<bool, 4> pregenerating_neighbors;
+        /**
+         * Runs the next generation stage of the pregenerating overmap, or starts over if
+         * its neighbors changed in the meantime. Moves it into overmaps once it is complete.
+         */
+        void pregenerate_stage();
+        /** Moves the pregenerating overmap into overmaps and runs its remaining stages. */
+        overmap &finish_pregenerating();
+        // The existing overmaps north, east, south and west of the given one, or nullptr.
+        std::array<const overmap *, 4> get_existing_neighbors( const point &p );
+
         /**
          * Get a list of notes in the (loaded) overmaps.
          * @param z only this specific z-level is search for notes.
@@ -11,6 +11,7 @@
 #include "sdl_utils.h"
 #include "vehicle.h"
 #include "vpart_position.h"
+#include "vpart_range.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "color.h"
@@ -172,6 +173,10 @@ struct pixel_minimap::submap_cache {
     std::vector<point> update_list;
     //flag used to indicate that the texture needs to be cleared before first use
     bool ready;
+    //stamps of the terrain and visibility the colors were taken from
+    //they are compared with those of the map to only update submaps that changed
+    int terrain_stamp = -1;
+    int visibility_stamp = -1;
     shared_texture_pool &pool;
 
     //reserve the SEEX * SEEY submap tiles
@@ -354,9 +359,40 @@ void pixel_minimap::process_cache( const tripoint &center )
 {
     prepare_cache_for_updates( center );
 
+    const level_cache &access_cache = g->m.access_cache( center.z );
+
+    //vehicles don't report changes of their parts, the submaps they cover are always updated
+    std::bitset<MAPSIZE *MAPSIZE> vehicle_submaps;
+    for( vehicle *veh : access_cache.vehicle_list ) {
+        for( const vpart_reference &vp : veh->get_all_parts() ) {
+            const tripoint p = vp.pos();
+            if( g->m.inbounds( p ) ) {
+                vehicle_submaps.set( p.y / SEEY * MAPSIZE + p.x / SEEX );
+            }
+        }
+    }
+
+    const bool nv_goggle = g->u.get_vision_modes()[NV_GOGGLES];
+    const bool update_all = nv_goggle != cached_nv_goggle;
+    cached_nv_goggle = nv_goggle;
+
     for( int y = 0; y < MAPSIZE; ++y ) {
         for( int x = 0; x < MAPSIZE; ++x ) {
-            update_cache_at( { x, y, center.z } );
+            const tripoint sm_pos = { x, y, center.z };
+            submap_cache &cache_item = get_cache_at( g->m.get_abs_sub() + sm_pos );
+            const int terrain_stamp = g->m.get_terrain_stamp( sm_pos );
+            const int visibility_stamp = access_cache.visibility_stamps[x][y];
+
+            cache_item.touched = true;
+            if( !update_all && !vehicle_submaps[y * MAPSIZE + x] &&
+                cache_item.terrain_stamp == terrain_stamp &&
+                cache_item.visibility_stamp == visibility_stamp ) {
+                continue;
+            }
+            cache_item.terrain_stamp = terrain_stamp;
+            cache_item.visibility_stamp = visibility_stamp;
+
+            update_cache_at( sm_pos );
         }
     }
 
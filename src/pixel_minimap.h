@@ -74,6 +74,8 @@ class pixel_minimap
 
         //track the previous viewing area to determine if the minimap cache needs to be cleared
         tripoint cached_center_sm;
+        //the colors of the whole cache depend on whether night vision is in use
+        bool cached_nv_goggle = false;
 
         SDL_Rect screen_rect;
         SDL_Rect main_tex_clip_rect;
@@ -2707,6 +2707,8 @@ void vehicle::deserialize( JsonIn &jsin )
     data.read( "theft_time", theft_time );
 
     data.read( "parts", parts );
+    // The part indices from before loading don't apply to the new parts
+    parts_by_flag.clear();
 
     // we persist the pivot anchor so that if the rules for finding
     // the pivot change, existing vehicles do not shift around.
@@ -3205,36 +3207,71 @@ void player_morale::load( const JsonObject &jsin )
 
 void map_memory::store( JsonOut &jsout ) const
 {
+    // Submaps are written from the least to the most recently memorized so the
+    // order survives loading. Each one is run-length encoded, the remembered areas
+    // are mostly the same few tiles repeated.
+    std::unordered_map<std::uint32_t, int> file_ids{ { 0, 0 } };
+    std::vector<std::uint32_t> used_ids{ 0 };
+    const auto file_id = [&]( std::uint32_t tile ) {
+        const auto inserted = file_ids.emplace( tile, static_cast<int>( used_ids.size() ) );
+        if( inserted.second ) {
+            used_ids.push_back( tile );
+        }
+        return inserted.first->second;
+    };
+
+    jsout.start_object();
+    jsout.member( "submaps" );
     jsout.start_array();
-    jsout.start_array();
-    for( const auto &elem : tile_cache.list() ) {
+    for( const tripoint &sm : recent ) {
+        const submap_memory &mem = submaps.at( sm );
         jsout.start_array();
-        jsout.write( elem.first.x );
-        jsout.write( elem.first.y );
-        jsout.write( elem.first.z );
-        jsout.write( elem.second.tile );
-        jsout.write( elem.second.subtile );
-        jsout.write( elem.second.rotation );
+        jsout.write( sm.x );
+        jsout.write( sm.y );
+        jsout.write( sm.z );
+        jsout.start_array();
+        for( size_t i = 0; i < mem.tiles.size(); ) {
+            const memorized_tile &tile = mem.tiles[i];
+            size_t run = 1;
+            while( i + run < mem.tiles.size() && mem.tiles[i + run].tile == tile.tile &&
+                   mem.tiles[i + run].subtile == tile.subtile &&
+                   mem.tiles[i + run].rotation == tile.rotation ) {
+                run++;
+            }
+            jsout.write( file_id( tile.tile ) );
+            jsout.write( static_cast<int>( tile.subtile ) );
+            jsout.write( static_cast<int>( tile.rotation ) );
+            jsout.write( static_cast<int>( run ) );
+            i += run;
+        }
+        jsout.end_array();
+        jsout.start_array();
+        for( size_t i = 0; i < mem.symbols.size(); ) {
+            size_t run = 1;
+            while( i + run < mem.symbols.size() && mem.symbols[i + run] == mem.symbols[i] ) {
+                run++;
+            }
+            jsout.write( mem.symbols[i] );
+            jsout.write( static_cast<int>( run ) );
+            i += run;
+        }
+        jsout.end_array();
         jsout.end_array();
     }
     jsout.end_array();
 
+    jsout.member( "tile_ids" );
     jsout.start_array();
-    for( const auto &elem : symbol_cache.list() ) {
-        jsout.start_array();
-        jsout.write( elem.first.x );
-        jsout.write( elem.first.y );
-        jsout.write( elem.first.z );
-        jsout.write( elem.second );
-        jsout.end_array();
+    for( const std::uint32_t tile : used_ids ) {
+        jsout.write( tile_id( tile ) );
     }
     jsout.end_array();
-    jsout.end_array();
+    jsout.end_object();
 }
 
 void map_memory::load( JsonIn &jsin )
 {
-    // Legacy loading of object version.
+    // Object versions: the per-submap one and the legacy one.
     if( jsin.test_object() ) {
         JsonObject jsobj = jsin.get_object();
         load( jsobj );
@@ -3242,8 +3279,8 @@ void map_memory::load( JsonIn &jsin )
         // This file is large enough that it's more than called for to minimize the
         // amount of data written and read and make it a bit less "friendly",
         // and use the streaming interface.
+        clear();
         jsin.start_array();
-        tile_cache.clear();
         jsin.start_array();
         while( !jsin.end_array() ) {
             jsin.start_array();
@@ -3258,7 +3295,6 @@ void map_memory::load( JsonIn &jsin )
                            tile, subtile, rotation );
             jsin.end_array();
         }
-        symbol_cache.clear();
         jsin.start_array();
         while( !jsin.end_array() ) {
             jsin.start_array();
@@ -3274,20 +3310,58 @@ void map_memory::load( JsonIn &jsin )
     }
 }
 
-// Deserializer for legacy object-based memory map.
 void map_memory::load( const JsonObject &jsin )
 {
-    tile_cache.clear();
-    for( JsonObject pmap : jsin.get_array( "map_memory_tiles" ) ) {
-        const tripoint p( pmap.get_int( "x" ), pmap.get_int( "y" ), pmap.get_int( "z" ) );
-        memorize_tile( std::numeric_limits<int>::max(), p, pmap.get_string( "tile" ),
-                       pmap.get_int( "subtile" ), pmap.get_int( "rotation" ) );
+    clear();
+    if( !jsin.has_member( "submaps" ) ) {
+        // Deserializer for legacy object-based memory map.
+        for( JsonObject pmap : jsin.get_array( "map_memory_tiles" ) ) {
+            const tripoint p( pmap.get_int( "x" ), pmap.get_int( "y" ), pmap.get_int( "z" ) );
+            memorize_tile( std::numeric_limits<int>::max(), p, pmap.get_string( "tile" ),
+                           pmap.get_int( "subtile" ), pmap.get_int( "rotation" ) );
+        }
+        for( JsonObject pmap : jsin.get_array( "map_memory_curses" ) ) {
+            const tripoint p( pmap.get_int( "x" ), pmap.get_int( "y" ), pmap.get_int( "z" ) );
+            memorize_symbol( std::numeric_limits<int>::max(), p, pmap.get_int( "symbol" ) );
+        }
+        return;
     }
 
-    symbol_cache.clear();
-    for( JsonObject pmap : jsin.get_array( "map_memory_curses" ) ) {
-        const tripoint p( pmap.get_int( "x" ), pmap.get_int( "y" ), pmap.get_int( "z" ) );
-        memorize_symbol( std::numeric_limits<int>::max(), p, pmap.get_int( "symbol" ) );
+    std::vector<std::uint32_t> tiles;
+    for( const std::string &id : jsin.get_string_array( "tile_ids" ) ) {
+        tiles.push_back( intern_tile( id ) );
+    }
+    for( JsonArray sm_data : jsin.get_array( "submaps" ) ) {
+        const tripoint sm( sm_data.get_int( 0 ), sm_data.get_int( 1 ), sm_data.get_int( 2 ) );
+        forget_submap( sm );
+        submap_memory &mem = submaps[sm];
+        mem.recency = recent.insert( recent.end(), sm );
+        JsonArray tile_runs = sm_data.get_array( 3 );
+        for( size_t i = 0; tile_runs.has_more(); ) {
+            memorized_tile tile;
+            tile.tile = tiles.at( tile_runs.next_int() );
+            tile.subtile = tile_runs.next_int();
+            tile.rotation = tile_runs.next_int();
+            const size_t end = std::min( i + tile_runs.next_int(), mem.tiles.size() );
+            std::fill( mem.tiles.begin() + i, mem.tiles.begin() + end, tile );
+            i = end;
+        }
+        JsonArray symbol_runs = sm_data.get_array( 4 );
+        for( size_t i = 0; symbol_runs.has_more(); ) {
+            const int symbol = symbol_runs.next_int();
+            const size_t end = std::min( i + symbol_runs.next_int(), mem.symbols.size() );
+            std::fill( mem.symbols.begin() + i, mem.symbols.begin() + end, symbol );
+            i = end;
+        }
+        for( size_t i = 0; i < mem.tiles.size(); i++ ) {
+            if( mem.has_memory( i ) ) {
+                mem.memorized++;
+            }
+        }
+        memorized += mem.memorized;
+        if( mem.memorized == 0 ) {
+            forget_submap( sm );
+        }
     }
 }
 
@@ -3989,6 +4063,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     field_count++;
                 }
                 fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) );
+                mark_field_tile( { i, j } );
             }
         }
     } else if( member_name == "graffiti" ) {
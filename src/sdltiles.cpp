@@ -244,6 +244,7 @@ static SDL_Joystick *joystick; // Only one joystick for now.
 
 using cata_cursesport::curseline;
 using cata_cursesport::cursecell;
+using cata_cursesport::glyph;
 static std::vector<curseline> oversized_framebuffer;
 static std::vector<curseline> terminal_framebuffer;
 static std::weak_ptr<void> winBuffer; //tracking last drawn window to fix the framebuffer
@@ -441,12 +442,12 @@ static void WinCreate()
     // Initialize framebuffer caches
     terminal_framebuffer.resize( TERMINAL_HEIGHT );
     for( int i = 0; i < TERMINAL_HEIGHT; i++ ) {
-        terminal_framebuffer[i].chars.assign( TERMINAL_WIDTH, cursecell( "" ) );
+        terminal_framebuffer[i].chars.assign( TERMINAL_WIDTH, cursecell( glyph() ) );
     }
 
     oversized_framebuffer.resize( TERMINAL_HEIGHT );
     for( int i = 0; i < TERMINAL_HEIGHT; i++ ) {
-        oversized_framebuffer[i].chars.assign( TERMINAL_WIDTH, cursecell( "" ) );
+        oversized_framebuffer[i].chars.assign( TERMINAL_WIDTH, cursecell( glyph() ) );
     }
 
     const Uint32 wformat = SDL_GetWindowPixelFormat( ::window.get() );
@@ -998,14 +999,14 @@ static void invalidate_framebuffer( std::vector<curseline> &framebuffer, int x,
                                     int height )
 {
     for( int j = 0, fby = y; j < height; j++, fby++ ) {
-        std::fill_n( framebuffer[fby].chars.begin() + x, width, cursecell( "" ) );
+        std::fill_n( framebuffer[fby].chars.begin() + x, width, cursecell( glyph() ) );
     }
 }
 
 static void invalidate_framebuffer( std::vector<curseline> &framebuffer )
 {
     for( curseline &i : framebuffer ) {
-        std::fill_n( i.chars.begin(), i.chars.size(), cursecell( "" ) );
+        std::fill_n( i.chars.begin(), i.chars.size(), cursecell( glyph() ) );
     }
 }
 
@@ -1016,11 +1017,11 @@ void reinitialize_framebuffer()
     const int new_width = std::max( TERMX, std::max( OVERMAP_WINDOW_WIDTH, TERRAIN_WINDOW_WIDTH ) );
     oversized_framebuffer.resize( new_height );
     for( int i = 0; i < new_height; i++ ) {
-        oversized_framebuffer[i].chars.assign( new_width, cursecell( "" ) );
+        oversized_framebuffer[i].chars.assign( new_width, cursecell( glyph() ) );
     }
     terminal_framebuffer.resize( new_height );
     for( int i = 0; i < new_height; i++ ) {
-        terminal_framebuffer[i].chars.assign( new_width, cursecell( "" ) );
+        terminal_framebuffer[i].chars.assign( new_width, cursecell( glyph() ) );
     }
 }
 
@@ -1318,7 +1319,7 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
     }
 
     // TODO: Get this from UTF system to make sure it is exactly the kind of space we need
-    static const std::string space_string = " ";
+    static constexpr glyph space_glyph( ' ' );
 
     bool update = false;
     for( int j = 0; j < win->height; j++ ) {
@@ -1364,20 +1365,21 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
             }
 
             // Spaces are used a lot, so this does help noticeably
-            if( cell.ch == space_string ) {
+            if( cell.ch == space_glyph ) {
                 FillRectDIB( drawx, drawy, fontwidth, fontheight, cell.BG );
                 continue;
             }
-            const int codepoint = UTF8_getch( cell.ch );
+            const int codepoint = cell.ch.codepoint();
             const catacurses::base_color FG = cell.FG;
             const catacurses::base_color BG = cell.BG;
-            int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch );
+            int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : cell.ch.width();
             if( cw < 1 ) {
                 // utf8_width() may return a negative width
                 continue;
             }
+            const std::string ch = cell.ch.str();
             bool use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
-            unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
+            unsigned char uc = static_cast<unsigned char>( ch[0] );
             switch( codepoint ) {
                 case LINE_XOXO_UNICODE:
                     uc = LINE_XOXO_C;
@@ -1423,7 +1425,7 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
             if( use_draw_ascii_lines_routine ) {
                 draw_ascii_lines( uc, drawx, drawy, FG );
             } else {
-                OutputChar( cell.ch, drawx, drawy, FG );
+                OutputChar( ch, drawx, drawy, FG );
             }
         }
     }
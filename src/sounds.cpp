@@ -2,7 +2,9 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <climits>
 #include <cmath>
 #include <memory>
 #include <ostream>
@@ -240,6 +242,50 @@ static std::vector<centroid> cluster_sounds( std::vector<std::pair<tripoint, int
     return sound_clusters;
 }
 
+// Fills dist with the acoustic distance from source to every tile on its z-level: the number of
+// tiles sound travels to get there, with walls and closed doors counting as several tiles.
+// Tiles further than max_dist are left at INT_MAX.
+// Tile costs are small integers, so a ring of buckets keyed by distance serves as the priority
+// queue (Dial's algorithm). The buckets are passed in to be reused, they are left empty.
+using sound_buckets = std::array<std::vector<point>, UINT8_MAX + 1>;
+static void flood_sound( const tripoint &source, const int max_dist, std::vector<int> &dist,
+                         sound_buckets &buckets )
+{
+    g->m.build_acoustic_cache( source.z );
+    const auto &acoustic_cache = g->m.get_cache_ref( source.z ).acoustic_cache;
+    const auto index = []( const point & p ) {
+        return p.x + p.y * MAPSIZE_X;
+    };
+
+    dist.assign( MAPSIZE_X * MAPSIZE_Y, INT_MAX );
+    dist[index( source.xy() )] = 0;
+    buckets[0].push_back( source.xy() );
+    size_t pending = 1;
+    for( int d = 0; pending > 0 && d <= max_dist; d++ ) {
+        std::vector<point> &bucket = buckets[d % buckets.size()];
+        pending -= bucket.size();
+        for( const point &p : bucket ) {
+            if( dist[index( p )] != d ) {
+                // Already reached by a shorter path
+                continue;
+            }
+            for( const tripoint &offset : eight_horizontal_neighbors ) {
+                const point n = p + offset.xy();
+                if( n.x < 0 || n.y < 0 || n.x >= MAPSIZE_X || n.y >= MAPSIZE_Y ) {
+                    continue;
+                }
+                const int n_dist = d + acoustic_cache[n.x][n.y];
+                if( n_dist <= max_dist && n_dist < dist[index( n )] ) {
+                    dist[index( n )] = n_dist;
+                    buckets[n_dist % buckets.size()].push_back( n );
+                    pending++;
+                }
+            }
+        }
+        bucket.clear();
+    }
+}
+
 static int get_signal_for_hordes( const centroid &centr )
 {
     //Volume in  tiles. Signal for hordes in submaps
@@ -269,6 +315,9 @@ void sounds::process_sounds()
 {
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = weather::sound_attn( g->weather.weather );
+    std::vector<int> acoustic_dist;
+    sound_buckets buckets;
+    std::vector<std::pair<tripoint, int>> horde_signals;
     for( const auto &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -283,18 +332,31 @@ void sounds::process_sounds()
             const point abs_ms = g->m.getabs( source.xy() );
             const point abs_sm = ms_to_sm_copy( abs_ms );
             const tripoint target( abs_sm, source.z );
-            overmap_buffer.signal_hordes( target, sig_power );
+            horde_signals.emplace_back( target, sig_power );
+        }
+        if( vol <= 0 ) {
+            continue;
+        }
+        // Propagate the sound through the map once, monsters on the same z-level
+        // just look up how far it traveled to reach them.
+        // Even monsters with good hearing can't hear it further than vol * 2.
+        const bool flooded = g->m.inbounds( source );
+        if( flooded ) {
+            flood_sound( source, vol * 2 - 1, acoustic_dist, buckets );
         }
         // Alert all monsters (that can hear) to the sound.
         for( monster &critter : g->all_monsters() ) {
             // TODO: Generalize this to Creature::hear_sound
-            const int dist = rl_dist( source, critter.pos() );
+            const tripoint &pos = critter.pos();
+            const int dist = flooded && pos.z == source.z && g->m.inbounds( pos ) ?
+                             acoustic_dist[pos.x + pos.y * MAPSIZE_X] : rl_dist( source, pos );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
                 critter.hear_sound( source, vol, dist );
             }
         }
     }
+    overmap_buffer.signal_hordes( horde_signals );
     recent_sounds.clear();
 }
 
@@ -35,6 +35,8 @@ void maptile_soa<sx, sy>::swap_soa_tile( const point &p, maptile_soa<1, 1> &othe
     std::swap( rad[p.x][p.y], **other.rad );
 }
 
+int submap::last_terrain_stamp = 0;
+
 submap::submap()
 {
     std::uninitialized_fill_n( &ter[0][0], elements, t_null );
@@ -44,6 +46,7 @@ submap::submap()
     std::uninitialized_fill_n( &rad[0][0], elements, 0 );
 
     is_uniform = false;
+    terrain_stamp = ++last_terrain_stamp;
 }
 
 submap::submap( submap && ) = default;
@@ -225,6 +228,18 @@ bool submap::contains_vehicle( vehicle *veh )
     return match != vehicles.end();
 }
 
+void submap::update_field_tiles()
+{
+    field_tiles.reset();
+    for( int i = 0; i < SEEX; i++ ) {
+        for( int j = 0; j < SEEY; j++ ) {
+            if( fld[i][j].field_count() > 0 ) {
+                mark_field_tile( { i, j } );
+            }
+        }
+    }
+}
+
 void submap::rotate( int turns )
 {
     turns = turns % 4;
@@ -274,6 +289,9 @@ void submap::rotate( int turns )
         elem.pos = rotate_point( elem.pos );
     }
 
+    update_field_tiles();
+    terrain_stamp = ++last_terrain_stamp;
+
     for( auto &elem : spawns ) {
         elem.pos = rotate_point( elem.pos );
     }
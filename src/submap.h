@@ -2,6 +2,7 @@
 #ifndef SUBMAP_H
 #define SUBMAP_H
 
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -88,10 +89,12 @@ class submap : maptile_soa<SEEX, SEEY>
         void set_furn( const point &p, furn_id furn ) {
             is_uniform = false;
             frn[p.x][p.y] = furn;
+            terrain_stamp = ++last_terrain_stamp;
         }
 
         void set_all_furn( const furn_id &furn ) {
             std::uninitialized_fill_n( &frn[0][0], elements, furn );
+            terrain_stamp = ++last_terrain_stamp;
         }
 
         ter_id get_ter( const point &p ) const {
@@ -101,10 +104,20 @@ class submap : maptile_soa<SEEX, SEEY>
         void set_ter( const point &p, ter_id terr ) {
             is_uniform = false;
             ter[p.x][p.y] = terr;
+            terrain_stamp = ++last_terrain_stamp;
         }
 
         void set_all_ter( const ter_id &terr ) {
             std::uninitialized_fill_n( &ter[0][0], elements, terr );
+            terrain_stamp = ++last_terrain_stamp;
+        }
+
+        /**
+         * Changes whenever terrain or furniture of this submap change. No two submaps
+         * share a stamp, so a stamp also tells whether the submap was replaced.
+         */
+        int get_terrain_stamp() const {
+            return terrain_stamp;
         }
 
         int get_radiation( const point &p ) const {
@@ -223,6 +236,17 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void rotate( int turns );
 
+        /** Index of the tile @p p in @ref field_tiles. */
+        static size_t field_tile_index( const point &p ) {
+            return p.x * SEEY + p.y;
+        }
+        /** Marks the tile @p p as (possibly) holding fields. */
+        void mark_field_tile( const point &p ) {
+            field_tiles.set( field_tile_index( p ) );
+        }
+        /** Rebuilds @ref field_tiles by scanning all the fields of this submap. */
+        void update_field_tiles();
+
         void store( JsonOut &jsout ) const;
         void load( JsonIn &jsin, const std::string &member_name, int version );
 
@@ -235,6 +259,12 @@ class submap : maptile_soa<SEEX, SEEY>
         active_item_cache active_items;
 
         int field_count = 0;
+        /**
+         * Tiles that may contain fields, see @ref field_tile_index.
+         * This is a superset of the tiles with fields: field processing only visits
+         * these tiles and drops the ones whose fields are gone.
+         */
+        std::bitset<SEEX * SEEY> field_tiles;
         time_point last_touched = calendar::turn_zero;
         std::vector<spawn_point> spawns;
         /**
@@ -250,6 +280,8 @@ class submap : maptile_soa<SEEX, SEEY>
         std::map<point, computer> computers;
         std::unique_ptr<computer> legacy_computer;
         int temperature = 0;
+        int terrain_stamp;
+        static int last_terrain_stamp;
 
         void update_legacy_computer();
 
@@ -313,6 +345,7 @@ struct maptile {
             const bool ret = sm->get_field( pos() ).add_field( field_to_add, new_intensity, new_age );
             if( ret ) {
                 sm->field_count++;
+                sm->mark_field_tile( pos() );
             }
 
             return ret;
@@ -101,6 +101,16 @@ static const std::unordered_map<std::string, vpart_bitflags> vpart_bitflag_map =
     { "REACTOR", VPFLAG_REACTOR },
     { "RAIL", VPFLAG_RAIL },
     { "TURRET_CONTROLS", VPFLAG_TURRET_CONTROLS },
+    { "TURRET", VPFLAG_TURRET },
+    { "WIND_POWERED", VPFLAG_WIND_POWERED },
+    { "FUNNEL", VPFLAG_FUNNEL },
+    { "UNMOUNT_ON_MOVE", VPFLAG_UNMOUNT_ON_MOVE },
+    { "EMITTER", VPFLAG_EMITTER },
+    { "STEERABLE", VPFLAG_STEERABLE },
+    { "TRACKED", VPFLAG_TRACKED },
+    { "SECURITY", VPFLAG_SECURITY },
+    { "EXTRA_DRAG", VPFLAG_EXTRA_DRAG },
+    { "CAMERA", VPFLAG_CAMERA },
 };
 
 static const std::vector<std::pair<std::string, veh_ter_mod>> standard_terrain_mod = {{
@@ -75,6 +75,16 @@ enum vpart_bitflags : int {
     VPFLAG_REACTOR,
     VPFLAG_RAIL,
     VPFLAG_TURRET_CONTROLS,
+    VPFLAG_TURRET,
+    VPFLAG_WIND_POWERED,
+    VPFLAG_FUNNEL,
+    VPFLAG_UNMOUNT_ON_MOVE,
+    VPFLAG_EMITTER,
+    VPFLAG_STEERABLE,
+    VPFLAG_TRACKED,
+    VPFLAG_SECURITY,
+    VPFLAG_EXTRA_DRAG,
+    VPFLAG_CAMERA,
 
     NUM_VPFLAGS
 };
@@ -214,6 +214,9 @@ units::volume vehicle_stack::max_volume() const
 
 // Vehicle class methods.
 
+// Bumped whenever vehicles that power grids point to may have changed.
+static int power_grid_changes = 0;
+
 vehicle::vehicle( const vproto_id &type_id, int init_veh_fuel,
                   int init_veh_status ): type( type_id )
 {
@@ -238,7 +241,10 @@ vehicle::vehicle() : vehicle( vproto_id() )
     sm_pos = tripoint_zero;
 }
 
-vehicle::~vehicle() = default;
+vehicle::~vehicle()
+{
+    power_grid_changes++;
+}
 
 bool vehicle::player_in_control( const player &p ) const
 {
@@ -3200,6 +3206,8 @@ void vehicle::precalc_mounts( int idir, int dir, const point &pivot )
     }
     tileray tdir( dir );
     std::unordered_map<point, point> mount_to_precalc;
+    rectangle &bounds = precalc_bounds[idir];
+    bounds = rectangle( point( INT_MAX, INT_MAX ), point( INT_MIN, INT_MIN ) );
     for( auto &p : parts ) {
         if( p.removed ) {
             continue;
@@ -3211,6 +3219,10 @@ void vehicle::precalc_mounts( int idir, int dir, const point &pivot )
         } else {
             p.precalc[idir] = q->second;
         }
+        bounds.p_min.x = std::min( bounds.p_min.x, p.precalc[idir].x );
+        bounds.p_min.y = std::min( bounds.p_min.y, p.precalc[idir].y );
+        bounds.p_max.x = std::max( bounds.p_max.x, p.precalc[idir].x );
+        bounds.p_max.y = std::max( bounds.p_max.y, p.precalc[idir].y );
     }
     pivot_anchor[idir] = pivot;
     pivot_rotation[idir] = dir;
@@ -3309,8 +3321,13 @@ units::volume vehicle::total_folded_volume() const
 
 const point &vehicle::rotated_center_of_mass() const
 {
-    // TODO: Bring back caching of this point
-    calc_mass_center( true );
+    // The rotated mount points are replaced when the vehicle moves or turns
+    if( mass_center_precalc_dirty || mass_center_precalc_anchor != pivot_anchor[0] ||
+        mass_center_precalc_rotation != pivot_rotation[0] ) {
+        calc_mass_center( true );
+        mass_center_precalc_anchor = pivot_anchor[0];
+        mass_center_precalc_rotation = pivot_rotation[0];
+    }
 
     return mass_center_precalc;
 }
@@ -4822,84 +4839,102 @@ void vehicle::enumerate_vehicles( std::map<vehicle *, bool> &connected_vehicles,
     }
 }
 
-template <typename Func, typename Vehicle>
-int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action )
+const std::vector<std::pair<vehicle *, int>> &vehicle::connected_power_grid() const
 {
-    // Breadth-first search! Initialize the queue with a pointer to ourselves and go!
-    std::queue< std::pair<Vehicle *, int> > connected_vehs;
-    std::set<Vehicle *> visited_vehs;
-    connected_vehs.push( std::make_pair( start_veh, 0 ) );
-
-    while( amount > 0 && !connected_vehs.empty() ) {
-        auto current_node = connected_vehs.front();
-        Vehicle *current_veh = current_node.first;
-        int current_loss = current_node.second;
+    if( power_grid_version == power_grid_changes ) {
+        return power_grid;
+    }
+    power_grid.clear();
+    // Breadth-first search! Initialize the queue with ourselves and go!
+    std::queue< std::pair<const vehicle *, int> > connected_vehs;
+    std::set<const vehicle *> visited_vehs{ this };
+    connected_vehs.push( std::make_pair( this, 0 ) );
 
-        visited_vehs.insert( current_veh );
+    while( !connected_vehs.empty() ) {
+        const vehicle *current_veh = connected_vehs.front().first;
+        const int current_loss = connected_vehs.front().second;
         connected_vehs.pop();
 
-        g->u.add_msg_if_player( m_debug, "Traversing graph with %d power", amount );
-
-        for( auto &p : current_veh->loose_parts ) {
+        for( const int p : current_veh->loose_parts ) {
             if( !current_veh->part_info( p ).has_flag( "POWER_TRANSFER" ) ) {
                 continue; // ignore loose parts that aren't power transfer cables
             }
 
-            auto target_veh = vehicle::find_vehicle( current_veh->parts[p].target.second );
-            if( target_veh == nullptr || visited_vehs.count( target_veh ) > 0 ) {
+            vehicle *target_veh = vehicle::find_vehicle( current_veh->parts[p].target.second );
+            if( target_veh == nullptr || !visited_vehs.insert( target_veh ).second ) {
                 // Either no destination here (that vehicle's rolled away or off-map) or
                 // we've already looked at that vehicle.
                 continue;
             }
+            const int target_loss = current_loss + current_veh->part_info( p ).epower;
+            connected_vehs.push( std::make_pair( target_veh, target_loss ) );
+            power_grid.emplace_back( target_veh, target_loss );
+        }
+    }
+    // Finding the vehicles may have loaded submaps, that doesn't affect this grid.
+    power_grid_version = power_grid_changes;
+    return power_grid;
+}
 
-            // Add this connected vehicle to the queue of vehicles to search next,
-            // but only if we haven't seen this one before.
-            if( visited_vehs.count( target_veh ) < 1 ) {
-                int target_loss = current_loss + current_veh->part_info( p ).epower;
-                connected_vehs.push( std::make_pair( target_veh, target_loss ) );
-
-                float loss_amount = ( static_cast<float>( amount ) * static_cast<float>( target_loss ) ) / 100;
-                g->u.add_msg_if_player( m_debug, "Visiting remote %p with %d power (loss %f, which is %d percent)",
-                                        static_cast<void *>( target_veh ), amount, loss_amount, target_loss );
+template <typename Func, typename Vehicle>
+int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action )
+{
+    for( const std::pair<vehicle *, int> &connected : start_veh->connected_power_grid() ) {
+        if( amount < 1 ) {
+            break; // No more charge to donate away.
+        }
+        Vehicle *target_veh = connected.first;
+        const int target_loss = connected.second;
 
-                amount = action( target_veh, amount, static_cast<int>( loss_amount ) );
-                g->u.add_msg_if_player( m_debug, "After remote %p, %d power", static_cast<void *>( target_veh ),
-                                        amount );
+        float loss_amount = ( static_cast<float>( amount ) * static_cast<float>( target_loss ) ) /
+                            100;
+        g->u.add_msg_if_player( m_debug,
+                                "Visiting remote %p with %d power (loss %f, which is %d percent)",
+                                static_cast<const void *>( target_veh ), amount, loss_amount,
+                                target_loss );
 
-                if( amount < 1 ) {
-                    break; // No more charge to donate away.
-                }
-            }
-        }
+        amount = action( target_veh, amount, static_cast<int>( loss_amount ) );
+        g->u.add_msg_if_player( m_debug, "After remote %p, %d power",
+                                static_cast<const void *>( target_veh ), amount );
     }
     return amount;
 }
 
 int vehicle::charge_battery( int amount, bool include_other_vehicles )
 {
-    // Key parts by percentage charge level.
-    std::multimap<int, vehicle_part *> chargeable_parts;
-    for( vehicle_part &p : parts ) {
-        if( p.is_available() && p.is_battery() && p.ammo_capacity() > p.ammo_remaining() ) {
-            chargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
-        }
-    }
-    while( amount > 0 && !chargeable_parts.empty() ) {
-        // Grab first part, charge until it reaches the next %, then re-insert with new % key.
-        auto iter = chargeable_parts.begin();
-        int charge_level = iter->first;
-        vehicle_part *p = iter->second;
-        chargeable_parts.erase( iter );
-        // Calculate number of charges to reach the next %, but insure it's at least
-        // one more than current charge.
-        int next_charge_level = ( ( charge_level + 1 ) * p->ammo_capacity() ) / 100;
-        next_charge_level = std::max( next_charge_level, p->ammo_remaining() + 1 );
-        int qty = std::min( amount, next_charge_level - p->ammo_remaining() );
-        p->ammo_set( fuel_type_battery, p->ammo_remaining() + qty );
-        amount -= qty;
-        if( p->ammo_capacity() > p->ammo_remaining() ) {
-            chargeable_parts.insert( { ( p->ammo_remaining() * 100 ) / p->ammo_capacity(), p } );
+    // Fill the batteries in proportion to the room left in them.
+    int room = 0;
+    for( const int b : batteries ) {
+        const vehicle_part &p = parts[b];
+        if( p.is_available() ) {
+            room += p.ammo_capacity() - p.ammo_remaining();
+        }
+    }
+    const int charged = std::min( amount, room );
+    if( charged > 0 ) {
+        int left = charged;
+        for( const int b : batteries ) {
+            vehicle_part &p = parts[b];
+            if( p.is_available() ) {
+                const int part_room = p.ammo_capacity() - p.ammo_remaining();
+                const int qty = static_cast<int64_t>( charged ) * part_room / room;
+                p.ammo_set( fuel_type_battery, p.ammo_remaining() + qty );
+                left -= qty;
+            }
+        }
+        // Hand out what was lost to rounding.
+        for( const int b : batteries ) {
+            vehicle_part &p = parts[b];
+            if( left <= 0 ) {
+                break;
+            }
+            if( p.is_available() ) {
+                const int qty = std::min( left, p.ammo_capacity() - p.ammo_remaining() );
+                p.ammo_set( fuel_type_battery, p.ammo_remaining() + qty );
+                left -= qty;
+            }
         }
+        amount -= charged;
     }
 
     auto charge_visitor = []( vehicle * veh, int amount, int lost ) {
@@ -4916,27 +4951,39 @@ int vehicle::charge_battery( int amount, bool include_other_vehicles )
 
 int vehicle::discharge_battery( int amount, bool recurse )
 {
-    // Key parts by percentage charge level.
-    std::multimap<int, vehicle_part *> dischargeable_parts;
-    for( vehicle_part &p : parts ) {
-        if( p.is_available() && p.is_battery() && p.ammo_remaining() > 0 ) {
-            dischargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
-        }
-    }
-    while( amount > 0 && !dischargeable_parts.empty() ) {
-        // Grab first part, discharge until it reaches the next %, then re-insert with new % key.
-        auto iter = std::prev( dischargeable_parts.end() );
-        int charge_level = iter->first;
-        vehicle_part *p = iter->second;
-        dischargeable_parts.erase( iter );
-        // Calculate number of charges to reach the previous %.
-        int prev_charge_level = ( ( charge_level - 1 ) * p->ammo_capacity() ) / 100;
-        int amount_to_discharge = std::min( p->ammo_remaining() - prev_charge_level, amount );
-        p->ammo_consume( amount_to_discharge, global_part_pos3( *p ) );
-        amount -= amount_to_discharge;
-        if( p->ammo_remaining() > 0 ) {
-            dischargeable_parts.insert( { ( p->ammo_remaining() * 100 ) / p->ammo_capacity(), p } );
+    // Drain the batteries in proportion to the charge left in them.
+    int stored = 0;
+    for( const int b : batteries ) {
+        const vehicle_part &p = parts[b];
+        if( p.is_available() ) {
+            stored += p.ammo_remaining();
+        }
+    }
+    const int discharged = std::min( amount, stored );
+    if( discharged > 0 ) {
+        int left = discharged;
+        for( const int b : batteries ) {
+            vehicle_part &p = parts[b];
+            const int part_stored = p.is_available() ? p.ammo_remaining() : 0;
+            const int qty = static_cast<int64_t>( discharged ) * part_stored / stored;
+            if( qty > 0 ) {
+                p.ammo_consume( qty, global_part_pos3( p ) );
+                left -= qty;
+            }
+        }
+        // Take what was lost to rounding.
+        for( const int b : batteries ) {
+            vehicle_part &p = parts[b];
+            if( left <= 0 ) {
+                break;
+            }
+            const int qty = p.is_available() ? std::min( left, p.ammo_remaining() ) : 0;
+            if( qty > 0 ) {
+                p.ammo_consume( qty, global_part_pos3( p ) );
+                left -= qty;
+            }
         }
+        amount -= discharged;
     }
 
     auto discharge_visitor = []( vehicle * veh, int amount, int lost ) {
@@ -5391,10 +5438,17 @@ void vehicle::refresh()
     relative_parts.clear();
     loose_parts.clear();
     wheelcache.clear();
+    for( wheel_traction_cache &cache : wheel_traction ) {
+        cache.terrain_generation = -1;
+    }
     rail_wheelcache.clear();
     steering.clear();
     speciality.clear();
     floating.clear();
+    batteries.clear();
+    parts_by_flag.assign( NUM_VPFLAGS, std::vector<int>() );
+    flag_index_size = parts.size();
+    power_grid_changes++;
     alternator_load = 0;
     extra_drag = 0;
     all_wheels_on_one_axis = true;
@@ -5442,9 +5496,18 @@ void vehicle::refresh()
                                          static_cast<int>( p ), svpv );
         relative_parts[pt].insert( vii, p );
 
+        for( int f = 0; f < NUM_VPFLAGS; f++ ) {
+            if( vpi.has_flag( static_cast<vpart_bitflags>( f ) ) ) {
+                parts_by_flag[f].push_back( p );
+            }
+        }
+
         if( vpi.has_flag( VPFLAG_FLOATS ) ) {
             floating.push_back( p );
         }
+        if( vp.part().is_battery() ) {
+            batteries.push_back( p );
+        }
 
         if( vp.part().is_unavailable() ) {
             continue;
@@ -5461,22 +5524,22 @@ void vehicle::refresh()
         if( vpi.has_flag( VPFLAG_SOLAR_PANEL ) ) {
             solar_panels.push_back( p );
         }
-        if( vpi.has_flag( "WIND_TURBINE" ) ) {
+        if( vpi.has_flag( VPFLAG_WIND_TURBINE ) ) {
             wind_turbines.push_back( p );
         }
-        if( vpi.has_flag( "WIND_POWERED" ) ) {
+        if( vpi.has_flag( VPFLAG_WIND_POWERED ) ) {
             sails.push_back( p );
         }
-        if( vpi.has_flag( "WATER_WHEEL" ) ) {
+        if( vpi.has_flag( VPFLAG_WATER_WHEEL ) ) {
             water_wheels.push_back( p );
         }
-        if( vpi.has_flag( "FUNNEL" ) ) {
+        if( vpi.has_flag( VPFLAG_FUNNEL ) ) {
             funnels.push_back( p );
         }
-        if( vpi.has_flag( "UNMOUNT_ON_MOVE" ) ) {
+        if( vpi.has_flag( VPFLAG_UNMOUNT_ON_MOVE ) ) {
             loose_parts.push_back( p );
         }
-        if( vpi.has_flag( "EMITTER" ) ) {
+        if( vpi.has_flag( VPFLAG_EMITTER ) ) {
             emitters.push_back( p );
         }
         if( vpi.has_flag( VPFLAG_WHEEL ) ) {
@@ -5497,29 +5560,31 @@ void vehicle::refresh()
             railwheel_xmax = std::max( railwheel_xmax, pt.x );
             railwheel_ymax = std::max( railwheel_ymax, pt.y );
         }
-        if( ( vpi.has_flag( "STEERABLE" ) && part_with_feature( pt, "STEERABLE", true ) != -1 ) ||
-            vpi.has_flag( "TRACKED" ) ) {
+        if( ( vpi.has_flag( VPFLAG_STEERABLE ) &&
+              part_with_feature( static_cast<int>( p ), VPFLAG_STEERABLE, true ) != -1 ) ||
+            vpi.has_flag( VPFLAG_TRACKED ) ) {
             // TRACKED contributes to steering effectiveness but
             //  (a) doesn't count as a steering axle for install difficulty
             //  (b) still contributes to drag for the center of steering calculation
             steering.push_back( p );
         }
-        if( vpi.has_flag( "SECURITY" ) ) {
+        if( vpi.has_flag( VPFLAG_SECURITY ) ) {
             speciality.push_back( p );
         }
-        if( vp.part().enabled && vpi.has_flag( "EXTRA_DRAG" ) ) {
+        if( vp.part().enabled && vpi.has_flag( VPFLAG_EXTRA_DRAG ) ) {
             extra_drag += vpi.power;
         }
-        if( vpi.has_flag( "EXTRA_DRAG" ) && ( vpi.has_flag( "WIND_TURBINE" ) ||
-                                              vpi.has_flag( "WATER_WHEEL" ) ) ) {
+        if( vpi.has_flag( VPFLAG_EXTRA_DRAG ) && ( vpi.has_flag( VPFLAG_WIND_TURBINE ) ||
+                vpi.has_flag( VPFLAG_WATER_WHEEL ) ) ) {
             extra_drag += vpi.power;
         }
-        if( camera_on && vpi.has_flag( "CAMERA" ) ) {
+        if( camera_on && vpi.has_flag( VPFLAG_CAMERA ) ) {
             vp.part().enabled = true;
-        } else if( !camera_on && vpi.has_flag( "CAMERA" ) ) {
+        } else if( !camera_on && vpi.has_flag( VPFLAG_CAMERA ) ) {
             vp.part().enabled = false;
         }
-        if( vpi.has_flag( "TURRET" ) && !has_part( global_part_pos3( vp.part() ), "TURRET_CONTROLS" ) ) {
+        if( vpi.has_flag( VPFLAG_TURRET ) &&
+            !has_part( global_part_pos3( vp.part() ), "TURRET_CONTROLS" ) ) {
             vp.part().enabled = false;
         }
     }
@@ -5544,6 +5609,14 @@ void vehicle::refresh()
     invalidate_mass();
 }
 
+const std::vector<int> *vehicle::parts_with_flag( const vpart_bitflags flag ) const
+{
+    if( parts_by_flag.empty() || flag_index_size != parts.size() ) {
+        return nullptr;
+    }
+    return &parts_by_flag[flag];
+}
+
 const point &vehicle::pivot_point() const
 {
     if( pivot_dirty ) {
@@ -6515,6 +6588,24 @@ bool vehicle_part_with_feature_range<std::string>::matches( const size_t part )
            ( !( part_status_flag::enabled & required_ ) || vp.enabled );
 }
 
+template<>
+size_t vehicle_part_with_feature_range<std::string>::next_candidate( const size_t part ) const
+{
+    return part;
+}
+
+template<>
+size_t vehicle_part_with_feature_range<vpart_bitflags>::next_candidate( const size_t part ) const
+{
+    const std::vector<int> *indexed = this->vehicle().parts_with_flag( feature_ );
+    if( indexed == nullptr ) {
+        return part;
+    }
+    const auto iter = std::lower_bound( indexed->begin(), indexed->end(),
+                                        static_cast<int>( part ) );
+    return iter == indexed->end() ? this->part_count() : static_cast<size_t>( *iter );
+}
+
 template<>
 bool vehicle_part_with_feature_range<vpart_bitflags>::matches( const size_t part ) const
 {
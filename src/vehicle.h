@@ -141,6 +141,19 @@ struct bounding_box {
     point p2;
 };
 
+/**
+ * Wheel traction area of a vehicle where it currently stands, see map::vehicle_wheel_traction.
+ * It has to be recalculated once the vehicle moves or turns, its wheels change or the terrain
+ * changes (see map::get_terrain_generation).
+ */
+struct wheel_traction_cache {
+    tripoint abs_pos;
+    point pivot;
+    int rotation = 0;
+    int terrain_generation = -1;
+    float area = 0.0f;
+};
+
 char keybind( const std::string &opt, const std::string &context = "VEHICLE" );
 
 int mps_to_vmiph( double mps );
@@ -704,7 +717,16 @@ class vehicle
          */
         template <typename Func, typename Vehicle>
         static int traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action );
+        mutable std::vector<std::pair<vehicle *, int>> power_grid;
+        mutable int power_grid_version = -1;
     public:
+        /**
+         * The vehicles connected to this one by POWER_TRANSFER parts in the order
+         * traverse_vehicle_graph visits them, each with the percentage of power lost on
+         * the way there. Built on demand, rebuilt once any vehicle was created, destroyed
+         * or refreshed since.
+         */
+        const std::vector<std::pair<vehicle *, int>> &connected_power_grid() const;
         vehicle( const vproto_id &type_id, int init_veh_fuel = -1, int init_veh_status = -1 );
         vehicle();
         ~vehicle();
@@ -923,6 +945,12 @@ class vehicle
         std::vector<int> parts_at_relative( const point &dp, bool use_cache ) const;
 
         // returns index of part, inner to given, with certain flag, or -1
+        /**
+         * Sorted indices of the parts whose type has the given flag (removed, broken and
+         * unavailable parts may be included), or nullptr when the index is out of date.
+         */
+        const std::vector<int> *parts_with_flag( vpart_bitflags flag ) const;
+
         int part_with_feature( int p, const std::string &f, bool unbroken ) const;
         int part_with_feature( const point &pt, const std::string &f, bool unbroken ) const;
         int part_with_feature( int p, vpart_bitflags f, bool unbroken ) const;
@@ -1345,6 +1373,9 @@ class vehicle
         veh_collision part_collision( int part, const tripoint &p,
                                       bool just_detect, bool bash_floor );
 
+        // Whether any other vehicle on zlev has a bounding box overlapping the inclusive area
+        bool other_vehicle_overlaps( const rectangle &area, int zlev ) const;
+
         // Process the trap beneath
         void handle_trap( const tripoint &p, int part );
 
@@ -1666,11 +1697,18 @@ class vehicle
         std::vector<int> emitters;         // List of emitter parts
         std::vector<int> loose_parts;      // List of UNMOUNT_ON_MOVE parts
         std::vector<int> wheelcache;       // List of wheels
+        // Wheel traction with and without movement modifiers, reset by refresh
+        mutable std::array<wheel_traction_cache, 2> wheel_traction;
         std::vector<int> rail_wheelcache;  // List of rail wheels
         std::vector<int> steering;         // List of STEERABLE parts
         // List of parts that will not be on a vehicle very often, or which only one will be present
         std::vector<int> speciality;
         std::vector<int> floating;         // List of parts that provide buoyancy to boats
+        std::vector<int> batteries;        // List of battery indices, broken ones included
+        // Non-removed parts for each vpart_bitflags value, rebuilt by refresh()
+        std::vector<std::vector<int>> parts_by_flag;
+        // Size of parts when parts_by_flag was built, the index is stale once they differ
+        size_t flag_index_size = 0;
 
         // config values
         std::string name;   // vehicle name
@@ -1700,6 +1738,9 @@ class vehicle
         mutable point mount_max;
         mutable point mount_min;
         mutable point mass_center_precalc;
+        // The pivot the rotated center of mass was calculated for
+        mutable point mass_center_precalc_anchor;
+        mutable int mass_center_precalc_rotation = 0;
         mutable point mass_center_no_precalc;
         tripoint autodrive_local_target = tripoint_zero; // currrent node the autopilot is aiming for
 
@@ -1765,6 +1806,8 @@ class vehicle
         point front_right;
         // points used for rotation of mount precalc values
         std::array<point, 2> pivot_anchor;
+        // inclusive bounds of the precalc values of the non-removed parts
+        std::array<rectangle, 2> precalc_bounds;
         // frame direction
         tileray face;
         // direction we are moving
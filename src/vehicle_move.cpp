@@ -366,15 +366,36 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
 
     const int velocity_before = coll_velocity;
     const int sign_before = sgn( velocity_before );
-    bool empty = true;
+
+    // Broad phase: collect where every structure part will go due to movement (dx/dy/dz)
+    //  and turning (precalc[1]), and the bounding box of that footprint.
+    std::vector<std::pair<int, tripoint>> destinations;
+    const tripoint origin = global_pos3() + dp;
+    rectangle footprint( point( INT_MAX, INT_MAX ), point( INT_MIN, INT_MIN ) );
     for( int p = 0; static_cast<size_t>( p ) < parts.size(); p++ ) {
         if( part_info( p ).location != part_location_structure || parts[ p ].removed ) {
             continue;
         }
-        empty = false;
-        // Coordinates of where part will go due to movement (dx/dy/dz)
-        //  and turning (precalc[1])
-        const tripoint dsp = global_pos3() + dp + parts[p].precalc[1];
+        const tripoint dsp = origin + parts[p].precalc[1];
+        destinations.emplace_back( p, dsp );
+        footprint.p_min.x = std::min( footprint.p_min.x, dsp.x );
+        footprint.p_min.y = std::min( footprint.p_min.y, dsp.y );
+        footprint.p_max.x = std::max( footprint.p_max.x, dsp.x );
+        footprint.p_max.y = std::max( footprint.p_max.y, dsp.y );
+    }
+    const bool near_vehicles = !destinations.empty() &&
+                               other_vehicle_overlaps( footprint, origin.z );
+
+    bool empty = destinations.empty();
+    for( const std::pair<int, tripoint> &dest : destinations ) {
+        const int p = dest.first;
+        const tripoint &dsp = dest.second;
+        // Flat, empty ground can't be hit, so only do the narrow phase next to an actual obstacle.
+        if( !bash_floor && g->m.move_cost_ter_furn( dsp ) == 2 &&
+            g->critter_at( dsp, true ) == nullptr &&
+            !( near_vehicles && g->m.veh_at( dsp ) ) ) {
+            continue;
+        }
         veh_collision coll = part_collision( p, dsp, just_detect, bash_floor );
         if( coll.type == veh_coll_nothing ) {
             continue;
@@ -412,6 +433,27 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     return !colls.empty();
 }
 
+bool vehicle::other_vehicle_overlaps( const rectangle &area, int zlev ) const
+{
+    if( !g->m.inbounds_z( zlev ) ) {
+        return false;
+    }
+    for( const vehicle *other : g->m.get_cache_ref( zlev ).vehicle_list ) {
+        // Bounds of the parts as they are placed now, kept up to date by precalc_mounts
+        const rectangle &mounts = other->precalc_bounds[0];
+        if( other == this || mounts.p_min.x > mounts.p_max.x ) {
+            continue;
+        }
+        const point pos = other->global_pos3().xy();
+        const rectangle bounds( pos + mounts.p_min, pos + mounts.p_max );
+        if( bounds.p_min.x <= area.p_max.x && area.p_min.x <= bounds.p_max.x &&
+            bounds.p_min.y <= area.p_max.y && area.p_min.y <= bounds.p_max.y ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // A helper to make sure mass and density is always calculated the same way
 static void terrain_collision_data( const tripoint &p, bool bash_floor,
                                     float &mass, float &density, float &elastic )
@@ -1486,6 +1528,18 @@ float map::vehicle_wheel_traction( const vehicle &veh,
         return 0.0f;
     }
 
+    wheel_traction_cache &cache = veh.wheel_traction[ignore_movement_modifiers ? 1 : 0];
+    const tripoint abs_pos = getabs( veh.global_pos3() );
+    if( cache.terrain_generation == terrain_generation && cache.abs_pos == abs_pos &&
+        cache.pivot == veh.pivot_anchor[0] && cache.rotation == veh.pivot_rotation[0] ) {
+        return cache.area;
+    }
+    cache.abs_pos = abs_pos;
+    cache.pivot = veh.pivot_anchor[0];
+    cache.rotation = veh.pivot_rotation[0];
+    cache.terrain_generation = terrain_generation;
+    cache.area = 0.0f;
+
     float traction_wheel_area = 0.0f;
     for( int p : wheel_indices ) {
         const tripoint &pp = veh.global_part_pos3( p );
@@ -1524,6 +1578,7 @@ float map::vehicle_wheel_traction( const vehicle &veh,
         traction_wheel_area += 2.0 * wheel_area / move_mod;
     }
 
+    cache.area = traction_wheel_area;
     return traction_wheel_area;
 }
 
@@ -0,0 +1 @@
+#define VERSION "6639331-dirty"
@@ -32,9 +32,10 @@ class vehicle_part_iterator
             return range_.get();
         }
         void skip_to_next_valid( size_t i ) {
+            i = range().next_candidate( i );
             while( i < range().part_count() &&
                    !range().matches( i ) ) {
-                ++i;
+                i = range().next_candidate( i + 1 );
             }
             if( i < range().part_count() ) {
                 vp_.emplace( range().vehicle(), i );
@@ -136,6 +137,12 @@ class generic_vehicle_part_range
         ::vehicle &vehicle() const {
             return vehicle_.get();
         }
+
+        // First part index >= part that may match, ranges with an index of their parts
+        // can skip ahead instead of testing every part.
+        size_t next_candidate( const size_t part ) const {
+            return part;
+        }
 };
 
 /** A range that contains all parts of the vehicle. */
@@ -164,6 +171,7 @@ class vehicle_part_with_feature_range : public
                     feature_( std::move( f ) ), required_( r ) { }
 
         bool matches( size_t part ) const;
+        size_t next_candidate( size_t part ) const;
 };
 
 #endif
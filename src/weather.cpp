@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_map>
 
 #include "avatar.h"
 #include "calendar.h"
@@ -138,7 +139,7 @@ inline void proc_weather_sum( const weather_type wtype, weather_sum &data,
 
 weather_type current_weather( const tripoint &location, const time_point &t )
 {
-    const auto wgen = g->weather.get_cur_weather_gen();
+    const weather_generator &wgen = g->weather.get_cur_weather_gen();
     if( g->weather.weather_override != WEATHER_NULL ) {
         return g->weather.weather_override;
     }
@@ -146,12 +147,10 @@ weather_type current_weather( const tripoint &location, const time_point &t )
 }
 
 ////// Funnels.
-weather_sum sum_conditions( const time_point &start, const time_point &end,
-                            const tripoint &location )
+static void sum_conditions_sampled( weather_sum &data, const time_point &start,
+                                    const time_point &end, const tripoint &location )
 {
     time_duration tick_size = 0_turns;
-    weather_sum data;
-
     for( time_point t = start; t < end; t += tick_size ) {
         const time_duration diff = end - t;
         if( diff < 10_turns ) {
@@ -161,14 +160,75 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
         } else {
             tick_size = 1_minutes;
         }
+        tick_size = std::min( tick_size, diff );
 
         weather_type wtype = current_weather( location, t );
         proc_weather_sum( wtype, data, t, tick_size );
-        data.wind_amount += get_local_windpower( g->weather.windspeed,
-                            overmap_buffer.ter( ms_to_omt_copy( location ) ),
-                            location,
-                            g->weather.winddirection, false ) * to_turns<int>( tick_size );
     }
+}
+
+/**
+ * Rain and sunlight of a whole day, sampled hourly. The weather only changes over
+ * thousands of map squares, so days are cached per overmap terrain. Vehicles and
+ * funnels of the same base coming back into the reality bubble share them.
+ */
+static const weather_sum &daily_conditions( const time_point &day_start,
+        const tripoint &location )
+{
+    static std::unordered_map<tripoint, weather_sum> days;
+    static unsigned cached_seed = 0;
+    static weather_type cached_override = WEATHER_NULL;
+    if( cached_seed != g->get_seed() || cached_override != g->weather.weather_override ||
+        days.size() > 100000 ) {
+        days.clear();
+        cached_seed = g->get_seed();
+        cached_override = g->weather.weather_override;
+    }
+
+    const tripoint omt = ms_to_omt_copy( location );
+    const int day = to_days<int>( day_start - calendar::turn_zero );
+    const auto inserted = days.emplace( tripoint( omt.xy(), day ), weather_sum() );
+    if( inserted.second ) {
+        const tripoint sample_location( omt_to_ms_copy( omt.xy() ), location.z );
+        for( time_point t = day_start; t < day_start + 1_days; t += 1_hours ) {
+            proc_weather_sum( current_weather( sample_location, t ), inserted.first->second, t,
+                              1_hours );
+        }
+    }
+    return inserted.first->second;
+}
+
+weather_sum sum_conditions( const time_point &start, const time_point &end,
+                            const tripoint &location )
+{
+    weather_sum data;
+    if( start >= end ) {
+        return data;
+    }
+
+    // The last week is sampled every minute, and anything before it every hour. Whole days
+    // before the last week come from the cache, so they are only sampled the first time any
+    // vehicle or funnel on the same overmap terrain catches up on them.
+    const time_point minute_samples_from = end - 7_days;
+    const time_duration into_day = time_past_midnight( start );
+    const time_point first_day = into_day == 0_turns ? start : start - into_day + 1_days;
+    time_point t = start;
+    if( minute_samples_from - first_day >= 1_days ) {
+        sum_conditions_sampled( data, start, first_day, location );
+        for( t = first_day; minute_samples_from - t >= 1_days; t += 1_days ) {
+            const weather_sum &day = daily_conditions( t, location );
+            data.rain_amount += day.rain_amount;
+            data.acid_amount += day.acid_amount;
+            data.sunlight += day.sunlight;
+        }
+    }
+    sum_conditions_sampled( data, t, end, location );
+
+    // The wind is the current one, it doesn't need to be sampled.
+    data.wind_amount = get_local_windpower( g->weather.windspeed,
+                                            overmap_buffer.ter( ms_to_omt_copy( location ) ),
+                                            location, g->weather.winddirection, false ) *
+                       to_turns<int>( end - start );
     return data;
 }
 
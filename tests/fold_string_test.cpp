@@ -105,3 +105,25 @@ TEST_CASE( "fold-string" )
         check_equal( folded.begin(), folded.end(), expected.begin(), expected.end() );
     }
 }
+
+TEST_CASE( "parse_color_tags" )
+{
+    const std::string text = "plain <color_red>red 激活</color> <color_green>green</color>";
+    const auto parsed = parse_color_tags( text );
+    REQUIRE( parsed->segments.size() == 5 );
+    CHECK( parsed->segments[0].text == "plain " );
+    CHECK( parsed->segments[1].tag.type == color_tag_parse_result::open_color_tag );
+    CHECK( parsed->segments[1].tag.color == c_red );
+    CHECK( parsed->segments[1].text == "red 激活" );
+    CHECK( parsed->segments[1].width == 8 );
+    CHECK( parsed->segments[2].tag.type == color_tag_parse_result::close_color_tag );
+    CHECK( parsed->segments[2].text == " " );
+    CHECK( parsed->untagged == "plain red 激活 green" );
+    CHECK( parsed->width == 20 );
+
+    // Parsing the same text again gives the same result
+    CHECK( split_by_color( text ) == split_by_color( text ) );
+    CHECK( remove_color_tags( text ) == parsed->untagged );
+    CHECK( foldstring( text, 10 ) == foldstring( text, 10 ) );
+    CHECK( foldstring( text, 10 ) != foldstring( text, 30 ) );
+}
@@ -0,0 +1,79 @@
+#include <numeric>
+#include <vector>
+
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "field.h"
+#include "field_type.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "mapdata.h"
+#include "point.h"
+
+// Intensity and age in turns of the gas on every tile of a z-level
+struct gas_state {
+    std::vector<int> intensity;
+    std::vector<int> age;
+};
+
+static gas_state get_gas_state( const int zlev )
+{
+    gas_state state;
+    const int mapsize = g->m.getmapsize() * SEEX;
+    for( int x = 0; x < mapsize; ++x ) {
+        for( int y = 0; y < mapsize; ++y ) {
+            const field_entry *gas = g->m.get_field( tripoint( x, y, zlev ), fd_toxic_gas );
+            state.intensity.push_back( gas == nullptr ? 0 : gas->get_field_intensity() );
+            state.age.push_back( gas == nullptr ? 0 : to_turns<int>( gas->get_field_age() ) );
+        }
+    }
+    return state;
+}
+
+static gas_state diffuse_from_start( const tripoint &center, const int steps )
+{
+    clear_fields( center.z );
+    // A full ring around an empty tile, the ring would overflow it when spreading inwards
+    for( const tripoint &p : g->m.points_in_radius( center, 1 ) ) {
+        if( p != center ) {
+            g->m.add_field( p, fd_toxic_gas, 3, 100_turns );
+        }
+    }
+    g->m.add_field( center + point( -4, 0 ), fd_toxic_gas, 3, 40_turns );
+    g->m.add_field( center + point( 4, 1 ), fd_toxic_gas, 2, 7_turns );
+
+    const time_point start = calendar::turn;
+    for( int i = 0; i < steps; i++ ) {
+        g->m.diffuse_gases( center.z );
+        calendar::turn += 1_turns;
+    }
+    calendar::turn = start;
+    return get_gas_state( center.z );
+}
+
+TEST_CASE( "gas_diffusion_is_deterministic_and_conserves_gas", "[field]" )
+{
+    clear_map();
+    const tripoint center( 60, 60, 0 );
+    // A wall next to the cloud
+    for( int y = -3; y <= 3; y++ ) {
+        g->m.ter_set( center + point( 3, y ), t_wall );
+    }
+
+    const gas_state before = diffuse_from_start( center, 0 );
+    const gas_state first = diffuse_from_start( center, 50 );
+    const gas_state second = diffuse_from_start( center, 50 );
+
+    CHECK( first.intensity != before.intensity );
+    CHECK( first.intensity == second.intensity );
+    CHECK( first.age == second.age );
+    CHECK( std::accumulate( first.intensity.begin(), first.intensity.end(), 0 ) ==
+           std::accumulate( before.intensity.begin(), before.intensity.end(), 0 ) );
+    // Every unit of gas carries its share of the age along with it
+    CHECK( std::accumulate( first.age.begin(), first.age.end(), 0 ) ==
+           std::accumulate( before.age.begin(), before.age.end(), 0 ) );
+
+    clear_fields( center.z );
+}
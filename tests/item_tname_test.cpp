@@ -427,3 +427,32 @@ TEST_CASE( "weapon fouling", "[item][tname][fouling][dirt]" )
     }
 }
 
+
+TEST_CASE( "item names remembered while a name cache scope is open", "[item][tname][cache]" )
+{
+    g->u.empty_traits();
+    g->u.set_skill_level( skill_survival, 2 );
+    item coffee( "coffee_pod" );
+    item rag( "rag" );
+
+    {
+        const item::name_cache_scope names;
+        REQUIRE( coffee.tname() == "Kentucky coffee pod" );
+        REQUIRE( rag.tname() == "rag" );
+
+        // The player is assumed not to change while the scope is open
+        g->u.set_skill_level( skill_survival, 3 );
+        CHECK( coffee.tname() == "Kentucky coffee pod" );
+
+        rag.set_flag( flag_WET );
+        CHECK( rag.tname() == "rag (wet)" );
+        CHECK( rag.tname( 2 ) == "rags (wet)" );
+
+        item copy = rag;
+        copy.unset_flag( flag_WET );
+        CHECK( copy.tname() == "rag" );
+        CHECK( rag.tname() == "rag (wet)" );
+    }
+
+    CHECK( coffee.tname() == "Kentucky coffee pod (poisonous)" );
+}
@@ -1,8 +1,13 @@
+#include <chrono>
 #include <cstdio>
+#include <iterator>
+#include <list>
 #include <sstream>
 #include <bitset>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include "catch/catch.hpp"
 #include "map.h"
@@ -11,6 +16,7 @@
 #include "game_constants.h"
 #include "lru_cache.h"
 #include "point.h"
+#include "rng.h"
 
 static constexpr tripoint p1{ tripoint_above };
 static constexpr tripoint p2{ 0, 0, 2 };
@@ -90,35 +96,126 @@ TEST_CASE( "map_memory_survives_save_lod", "[map_memory]" )
     CHECK( memory.get_symbol( p3 ) == memory2.get_symbol( p3 ) );
 }
 
-#include <chrono>
+TEST_CASE( "map_memory_forgets_least_recent_submaps", "[map_memory]" )
+{
+    map_memory memory;
+    const tripoint first_sm( 1, 1, 0 );
+    const tripoint second_sm( SEEX * 5 + 3, 2, 0 );
+    const tripoint third_sm( -1, -1, 0 );
+    memory.memorize_tile( 3, first_sm, "t_floor", 1, 2 );
+    memory.memorize_tile( 3, first_sm + tripoint_east, "t_wall", 0, 0 );
+    memory.memorize_symbol( 3, second_sm, 'x' );
+    CHECK( memory.size() == 3 );
+    // Touching the first submap makes the second one the least recent.
+    memory.memorize_tile( 3, first_sm, "t_dirt", 0, 1 );
+    memory.memorize_symbol( 3, third_sm, 'y' );
+    CHECK( memory.size() == 3 );
+    CHECK( memory.get_symbol( second_sm ) == 0 );
+    CHECK( memory.get_symbol( third_sm ) == 'y' );
+    const memorized_terrain_tile tile = memory.get_tile( first_sm );
+    CHECK( tile.tile == "t_dirt" );
+    CHECK( tile.subtile == 0 );
+    CHECK( tile.rotation == 1 );
+    CHECK( memory.get_tile( first_sm + tripoint_east ).tile == "t_wall" );
 
-TEST_CASE( "lru_cache_perf", "[.]" )
+    memory.clear_memorized_tile( third_sm );
+    CHECK( memory.get_symbol( third_sm ) == 0 );
+    CHECK( memory.size() == 2 );
+}
+
+// The list and hash map based cache lru_cache used to be, kept as a reference.
+template<typename Key, typename Value>
+class list_lru_cache
 {
-    constexpr int max_size = 1000000;
-    lru_cache<tripoint, int> symbol_cache;
-    const auto start1 = std::chrono::high_resolution_clock::now();
-    for( int i = 0; i < 1000000; ++i ) {
+    public:
+        void insert( int limit, const Key &pos, const Value &t ) {
+            auto found = map.find( pos );
+            if( found == map.end() ) {
+                ordered_list.emplace_back( pos, t );
+                map[pos] = std::prev( ordered_list.end() );
+                while( map.size() > static_cast<size_t>( limit ) ) {
+                    map.erase( ordered_list.front().first );
+                    ordered_list.pop_front();
+                }
+            } else {
+                ordered_list.splice( ordered_list.end(), ordered_list, found->second );
+                found->second->second = t;
+            }
+        }
+        Value get( const Key &pos, const Value &default_ ) const {
+            auto found = map.find( pos );
+            return found != map.end() ? found->second->second : default_;
+        }
+        void remove( const Key &pos ) {
+            auto found = map.find( pos );
+            if( found != map.end() ) {
+                ordered_list.erase( found->second );
+                map.erase( found );
+            }
+        }
+        const std::list<std::pair<Key, Value>> &list() const {
+            return ordered_list;
+        }
+    private:
+        std::list<std::pair<Key, Value>> ordered_list;
+        std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator> map;
+};
+
+TEST_CASE( "lru_cache_matches_list_cache", "[map_memory]" )
+{
+    constexpr int limit = 500;
+    lru_cache<tripoint, int> cache;
+    list_lru_cache<tripoint, int> reference;
+    for( int i = 0; i < 20000; ++i ) {
+        const tripoint p( rng( -40, 40 ), rng( -40, 40 ), rng( -1, 1 ) );
+        if( one_in( 5 ) ) {
+            cache.remove( p );
+            reference.remove( p );
+        } else {
+            cache.insert( limit, p, i );
+            reference.insert( limit, p, i );
+        }
+        const tripoint q( rng( -40, 40 ), rng( -40, 40 ), rng( -1, 1 ) );
+        CHECK( cache.get( q, -1 ) == reference.get( q, -1 ) );
+    }
+    REQUIRE( cache.size() == reference.list().size() );
+    auto it = cache.begin();
+    for( const std::pair<tripoint, int> &elem : reference.list() ) {
+        CHECK( it->first == elem.first );
+        CHECK( it->second == elem.second );
+        ++it;
+    }
+    CHECK( it == cache.end() );
+}
+
+template<typename Cache>
+static long long time_insertions( Cache &cache, int limit, int rows )
+{
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < rows; ++i ) {
+        for( int j = -60; j <= 60; ++j ) {
+            cache.insert( limit, { i, j, 0 }, 1 );
+        }
+        // Look up a row inserted earlier, half as far along, like the renderer revisiting
+        // remembered tiles.
         for( int j = -60; j <= 60; ++j ) {
-            symbol_cache.insert( max_size, { i, j, 0 }, 1 );
+            cache.get( { i / 2, j, 0 }, 0 );
         }
     }
-    const auto end1 = std::chrono::high_resolution_clock::now();
-    const long long diff1 = std::chrono::duration_cast<std::chrono::microseconds>
-                            ( end1 - start1 ).count();
-    printf( "completed %d insertions in %lld microseconds.\n", max_size, diff1 );
-    /*
-     * Original tripoint hash    completed 1000000 insertions in 96136925 microseconds.
-     * Table based interleave v1 completed 1000000 insertions in 41435604 microseconds.
-     * Table based interleave v2 completed 1000000 insertions in 40856530 microseconds.
-     * Jbtw hash                 completed 1000000 insertions in 19049163 microseconds.
-     *                                                     rerun 21152804
-     * With 1024 batch           completed 1000000 insertions in 39902325 microseconds.
-     * backed out batching       completed 1000000 insertions in 20332498 microseconds.
-     * rerun                     completed 1000000 insertions in 21659107 microseconds.
-     * simple batching, disabled completed 1000000 insertions in 18541486 microseconds.
-     * simple batching, 1024     completed 1000000 insertions in 23102395 microseconds.
-     * rerun                     completed 1000000 insertions in 31337290 microseconds.
-     */
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+}
+
+TEST_CASE( "lru_cache_perf", "[.]" )
+{
+    constexpr int limit = 1000000;
+    constexpr int rows = 100000;
+    lru_cache<tripoint, int> cache;
+    list_lru_cache<tripoint, int> reference;
+    const long long flat_time = time_insertions( cache, limit, rows );
+    const long long list_time = time_insertions( reference, limit, rows );
+    printf( "lru_cache completed %d insertions in %lld microseconds.\n", rows * 121, flat_time );
+    printf( "list cache completed %d insertions in %lld microseconds.\n", rows * 121, list_time );
 }
 
 // There are 4 quadrants we want to check,
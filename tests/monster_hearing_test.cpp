@@ -0,0 +1,55 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "monster.h"
+#include "point.h"
+#include "sounds.h"
+#include "weather.h"
+
+// Makes a sound and returns how strongly the monster was drawn towards it, 0 if it wasn't heard.
+static int wander_urge_from_sound( monster &critter, const tripoint &source, const int vol )
+{
+    critter.wandf = 0;
+    sounds::reset_sounds();
+    sounds::sound( source, vol, sounds::sound_t::combat, "a loud bang" );
+    sounds::process_sounds();
+    return critter.wandf;
+}
+
+TEST_CASE( "monsters_hear_through_open_air_but_not_through_walls", "[sound]" )
+{
+    clear_map_and_put_player_underground();
+    const weather_type old_weather = g->weather.weather;
+    g->weather.weather = WEATHER_CLEAR;
+
+    const tripoint source( 60, 60, 0 );
+    const tripoint door = source + point( 2, 0 );
+    // The monster is 4 tiles away in a straight line, close enough to hear a sound of volume 6
+    monster &zombie = spawn_test_monster( "mon_zombie", source + point( 4, 0 ) );
+
+    SECTION( "open air" ) {
+        CHECK( wander_urge_from_sound( zombie, source, 6 ) > 0 );
+    }
+
+    // A long wall between the source and the monster, with a door in line with both
+    for( int y = -30; y <= 30; y++ ) {
+        g->m.ter_set( source + point( 2, y ), t_wall );
+    }
+
+    SECTION( "wall" ) {
+        CHECK( wander_urge_from_sound( zombie, source, 6 ) == 0 );
+    }
+    SECTION( "closed door" ) {
+        g->m.ter_set( door, t_door_c );
+        CHECK( wander_urge_from_sound( zombie, source, 6 ) == 0 );
+    }
+    SECTION( "open door" ) {
+        g->m.ter_set( door, t_door_o );
+        CHECK( wander_urge_from_sound( zombie, source, 6 ) > 0 );
+    }
+
+    g->weather.weather = old_weather;
+}
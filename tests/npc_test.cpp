@@ -447,3 +447,73 @@ TEST_CASE( "npc_can_target_player" )
     REQUIRE( hostile.current_target() != nullptr );
     CHECK( hostile.current_target() == static_cast<Creature *>( &g->u ) );
 }
+
+TEST_CASE( "pausing_npcs_think_again_when_something_changes" )
+{
+    clear_map();
+    g->place_player( tripoint( 60, 60, 0 ) );
+    npc &guy = spawn_npc( g->u.pos().xy() + point( 5, 0 ), "test_talker" );
+    guy.set_mission( NPC_MISSION_GUARD );
+    guy.goal = guy.global_omt_location();
+    const time_point start = calendar::turn;
+    if( calendar::once_every( 30_minutes ) ) {
+        // Camp jobs are handed out then, so NPCs always think
+        calendar::turn += 1_turns;
+    }
+
+    REQUIRE( guy.think_is_due() );
+    guy.move();
+    REQUIRE_FALSE( guy.think_is_due() );
+
+    SECTION( "keeps pausing" ) {
+        guy.move();
+        CHECK_FALSE( guy.think_is_due() );
+    }
+    SECTION( "after a while" ) {
+        calendar::turn += 5_turns;
+        CHECK( guy.think_is_due() );
+    }
+    SECTION( "when hurt" ) {
+        guy.apply_damage( nullptr, bp_torso, 1 );
+        CHECK( guy.think_is_due() );
+    }
+    SECTION( "when a monster shows up" ) {
+        spawn_test_monster( "mon_zombie", guy.pos() + point( 10, 0 ) );
+        CHECK( guy.think_is_due() );
+    }
+    SECTION( "when given new orders" ) {
+        guy.set_attitude( NPCATT_FOLLOW );
+        CHECK( guy.think_is_due() );
+    }
+
+    calendar::turn = start;
+    clear_map();
+}
+
+TEST_CASE( "npcs_sharing_a_turn_see_the_same_threats" )
+{
+    clear_map();
+    g->place_player( tripoint( 60, 60, 0 ) );
+    npc &first = spawn_npc( g->u.pos().xy() + point( 10, 0 ), "test_talker" );
+    npc &second = spawn_npc( g->u.pos().xy() + point( 10, 2 ), "test_talker" );
+    const efftype_id effect_npc_fire_bad( "npc_fire_bad" );
+
+    // Looked around before the fire started
+    first.regen_ai_cache();
+    REQUIRE_FALSE( first.has_effect( effect_npc_fire_bad ) );
+
+    g->m.add_field( g->u.pos() + point( 12, 1 ), fd_fire, 1 );
+    first.regen_ai_cache();
+    second.regen_ai_cache();
+    CHECK( first.has_effect( effect_npc_fire_bad ) );
+    CHECK( second.has_effect( effect_npc_fire_bad ) );
+
+    // A new weapon is noticed on the same turn
+    g->u.weapon = item();
+    const float unarmed_danger = first.character_danger( g->u );
+    g->u.weapon = item( "machete" );
+    CHECK( first.character_danger( g->u ) > unarmed_danger );
+
+    g->u.weapon = item();
+    clear_map();
+}
@@ -33,6 +33,37 @@ TEST_CASE( "set_and_get_overmap_scents" )
     REQUIRE( test_overmap->scent_at( { 75, 85, 0} ).initial_strength == 90 );
 }
 
+TEST_CASE( "overmap_layer_generation_follows_what_the_player_knows" )
+{
+    std::unique_ptr<overmap> test_overmap = std::make_unique<overmap>( point_zero );
+    const tripoint p( 75, 85, 0 );
+    const int other_layer = test_overmap->get_layer_generation( 1 );
+
+    int generation = test_overmap->get_layer_generation( 0 );
+    test_overmap->set_seen( p, true );
+    CHECK( test_overmap->get_layer_generation( 0 ) != generation );
+
+    // Nothing changed, so the layer keeps its generation
+    generation = test_overmap->get_layer_generation( 0 );
+    test_overmap->set_seen( p, true );
+    CHECK( test_overmap->get_layer_generation( 0 ) == generation );
+
+    test_overmap->add_note( p, "a note" );
+    CHECK( test_overmap->get_layer_generation( 0 ) != generation );
+    REQUIRE( test_overmap->get_notes( 0 ).size() == 1 );
+    CHECK( test_overmap->get_notes( 0 ).front().p == p.xy() );
+
+    generation = test_overmap->get_layer_generation( 0 );
+    test_overmap->delete_note( p );
+    CHECK( test_overmap->get_layer_generation( 0 ) != generation );
+
+    generation = test_overmap->get_layer_generation( 0 );
+    test_overmap->set_explored( p, true );
+    CHECK( test_overmap->get_layer_generation( 0 ) != generation );
+
+    CHECK( test_overmap->get_layer_generation( 1 ) == other_layer );
+}
+
 TEST_CASE( "default_overmap_generation_always_succeeds" )
 {
     int overmaps_to_construct = 10;
@@ -106,3 +137,42 @@ TEST_CASE( "default_overmap_generation_has_non_mandatory_specials_at_origin" )
     CHECK( found_optional == true );
 }
 
+
+TEST_CASE( "overmaps_near_the_border_get_pregenerated" )
+{
+    const point om_pos( 30, 30 );
+    const tripoint base( om_pos.x * OMAPX, om_pos.y * OMAPY, 0 );
+    REQUIRE_FALSE( overmap_buffer.has( om_pos + point_east ) );
+    REQUIRE_FALSE( overmap_buffer.has( om_pos + point_south ) );
+    REQUIRE_FALSE( overmap_buffer.has( om_pos + point_south_east ) );
+
+    // Nothing to prepare in the middle of an overmap.
+    CHECK_FALSE( overmap_buffer.pregenerate_near( base + point( OMAPX / 2, OMAPY / 2 ) ) );
+
+    // Close to the eastern border only the eastern neighbor is needed. It is generated a stage
+    // per call and only shows up once it is complete.
+    const tripoint east_border = base + point( OMAPX - 1, OMAPY / 2 );
+    CHECK( overmap_buffer.pregenerate_near( east_border ) );
+    CHECK_FALSE( overmap_buffer.has( om_pos + point_east ) );
+    int calls = 1;
+    while( overmap_buffer.pregenerate_near( east_border ) ) {
+        calls++;
+    }
+    CHECK( calls > 1 );
+    CHECK( overmap_buffer.has( om_pos + point_east ) );
+
+    // In the corner the southern neighbor goes before the diagonal one. Asking for the one
+    // being generated finishes it right away.
+    const tripoint corner = base + point( OMAPX - 1, OMAPY - 1 );
+    CHECK( overmap_buffer.pregenerate_near( corner ) );
+    CHECK_FALSE( overmap_buffer.has( om_pos + point_south ) );
+    overmap_buffer.get( om_pos + point_south );
+    CHECK( overmap_buffer.has( om_pos + point_south ) );
+    CHECK( overmap_buffer.pregenerate_near( corner ) );
+    CHECK_FALSE( overmap_buffer.has( om_pos + point_south_east ) );
+    while( overmap_buffer.pregenerate_near( corner ) ) {
+    }
+    CHECK( overmap_buffer.has( om_pos + point_south_east ) );
+
+    overmap_buffer.clear();
+}
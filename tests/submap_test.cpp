@@ -1,5 +1,6 @@
 #include "catch/catch.hpp"
 #include "submap.h"
+#include "field_type.h"
 #include "game_constants.h"
 #include "int_id.h"
 #include "point.h"
@@ -88,3 +89,45 @@ TEST_CASE( "submap rotation", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap field tiles follow rotation", "[submap][field]" )
+{
+    constexpr auto corner_1 = point_zero;
+    constexpr auto corner_2 = point{ SEEX - 1, 0 };
+
+    submap sm;
+    sm.get_field( corner_1 ).add_field( fd_smoke, 1 );
+    sm.mark_field_tile( corner_1 );
+    REQUIRE( sm.field_tiles.count() == 1 );
+
+    sm.rotate( 1 );
+
+    CHECK( sm.field_tiles.count() == 1 );
+    CHECK_FALSE( sm.field_tiles[submap::field_tile_index( corner_1 )] );
+    CHECK( sm.field_tiles[submap::field_tile_index( corner_2 )] );
+}
+
+TEST_CASE( "submap_terrain_stamp_changes_with_terrain_and_furniture", "[submap]" )
+{
+    submap sm;
+    submap other;
+    CHECK( sm.get_terrain_stamp() != other.get_terrain_stamp() );
+
+    int stamp = sm.get_terrain_stamp();
+    sm.set_ter( point_zero, ter_id( 1 ) );
+    CHECK( sm.get_terrain_stamp() != stamp );
+
+    stamp = sm.get_terrain_stamp();
+    sm.set_furn( point_south_east, furn_id( 1 ) );
+    CHECK( sm.get_terrain_stamp() != stamp );
+
+    stamp = sm.get_terrain_stamp();
+    sm.rotate( 1 );
+    CHECK( sm.get_terrain_stamp() != stamp );
+
+    stamp = sm.get_terrain_stamp();
+    sm.set_radiation( point_zero, 10 );
+    sm.get_ter( point_zero );
+    CHECK( sm.get_terrain_stamp() == stamp );
+    CHECK( other.get_terrain_stamp() != stamp );
+}
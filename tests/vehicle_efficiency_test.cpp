@@ -1,3 +1,4 @@
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
@@ -448,3 +449,39 @@ TEST_CASE( "vehicle_efficiency", "[vehicle] [engine]" )
     test_vehicle( "road_roller", 8829220, 357200, 380200, 22760, 6925 );
     test_vehicle( "golf_cart", 444630, 52460, 105500, 27250, 14200 );
 }
+
+// Average microseconds it takes to drive the vehicle on pavement for a turn at cruising speed
+static long long time_driving( const vproto_id &veh_id, const int turns )
+{
+    clear_game( ter_id( "t_pavement" ) );
+    vehicle *veh_ptr = g->m.add_vehicle( veh_id, tripoint( 60, 60, 0 ), -90, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    set_vehicle_fuel( veh, 1.0f );
+    veh.check_falling_or_floating();
+
+    const tripoint starting_point = veh.global_pos3();
+    veh.tags.insert( "IN_CONTROL_OVERRIDE" );
+    veh.engine_on = true;
+    veh.cruise_velocity = std::min( 70 * 100, veh.safe_ground_velocity( false ) );
+    veh.velocity = veh.cruise_velocity;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < turns; i++ ) {
+        g->m.vehmove();
+        veh.idle( true );
+        g->m.displace_vehicle( veh, starting_point - veh.global_pos3() );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count() / turns;
+}
+
+TEST_CASE( "vehicle_drive_cost_per_turn", "[.]" )
+{
+    for( const std::string type : {
+             "bicycle", "car", "fire_truck", "semi_truck"
+         } ) {
+        printf( "Driving %s takes %lld microseconds per turn.\n", type.c_str(),
+                time_driving( vproto_id( type ), 1000 ) );
+    }
+}
@@ -5,8 +5,12 @@
 #include "catch/catch.hpp"
 #include "game.h"
 #include "map.h"
+#include "map_helpers.h"
 #include "map_iterator.h"
+#include "veh_type.h"
 #include "vehicle.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 #include "calendar.h"
 #include "weather.h"
 #include "game_constants.h"
@@ -88,3 +92,110 @@ TEST_CASE( "vehicle_power" )
         CHECK( veh_ptr->fuel_left( fuel_type_battery ) == 0 );
     }
 }
+
+static vehicle *battery_test_vehicle( const tripoint &pos )
+{
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "bicycle" ), pos, 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    for( const vpart_reference &vp : veh_ptr->get_any_parts( "BATTERY" ) ) {
+        veh_ptr->remove_part( static_cast<int>( vp.part_index() ) );
+    }
+    veh_ptr->part_removal_cleanup();
+    REQUIRE( veh_ptr->install_part( point_zero, vpart_id( "small_storage_battery" ), true ) >= 0 );
+    REQUIRE( veh_ptr->install_part( point_zero, vpart_id( "medium_storage_battery" ), true ) >= 0 );
+    REQUIRE( veh_ptr->batteries.size() == 2 );
+    for( const int b : veh_ptr->batteries ) {
+        veh_ptr->parts[b].ammo_set( fuel_type_battery, 0 );
+    }
+    return veh_ptr;
+}
+
+TEST_CASE( "vehicle_batteries_share_charge_proportionally" )
+{
+    clear_map();
+    vehicle *veh_ptr = battery_test_vehicle( tripoint( 10, 10, 0 ) );
+    vehicle_part &small = veh_ptr->parts[veh_ptr->batteries[0]];
+    vehicle_part &medium = veh_ptr->parts[veh_ptr->batteries[1]];
+    const int small_capacity = small.ammo_capacity();
+    const int medium_capacity = medium.ammo_capacity();
+    REQUIRE( small_capacity < medium_capacity );
+
+    SECTION( "charging fills batteries in proportion to their room" ) {
+        medium.ammo_set( fuel_type_battery, medium_capacity / 2 );
+        const int small_room = small_capacity;
+        const int medium_room = medium_capacity - medium_capacity / 2;
+        const int amount = ( small_room + medium_room ) / 3;
+        CHECK( veh_ptr->charge_battery( amount, false ) == 0 );
+        const int small_gain = small.ammo_remaining();
+        const int medium_gain = medium.ammo_remaining() - medium_capacity / 2;
+        CHECK( small_gain + medium_gain == amount );
+        const double expected_small = static_cast<double>( amount ) * small_room /
+                                      ( small_room + medium_room );
+        CHECK( small_gain >= static_cast<int>( expected_small ) );
+        CHECK( small_gain <= static_cast<int>( expected_small ) + 1 );
+    }
+    SECTION( "discharging drains batteries in proportion to their charge" ) {
+        small.ammo_set( fuel_type_battery, small_capacity );
+        medium.ammo_set( fuel_type_battery, medium_capacity );
+        const int amount = ( small_capacity + medium_capacity ) / 3;
+        CHECK( veh_ptr->discharge_battery( amount, false ) == 0 );
+        const int small_loss = small_capacity - small.ammo_remaining();
+        const int medium_loss = medium_capacity - medium.ammo_remaining();
+        CHECK( small_loss + medium_loss == amount );
+        const double expected_small = static_cast<double>( amount ) * small_capacity /
+                                      ( small_capacity + medium_capacity );
+        CHECK( small_loss >= static_cast<int>( expected_small ) );
+        CHECK( small_loss <= static_cast<int>( expected_small ) + 1 );
+    }
+    SECTION( "charge lost to rounding is handed out" ) {
+        // Both proportional shares round down to 0
+        CHECK( veh_ptr->charge_battery( 1, false ) == 0 );
+        CHECK( small.ammo_remaining() + medium.ammo_remaining() == 1 );
+        CHECK( veh_ptr->discharge_battery( 1, false ) == 0 );
+        CHECK( small.ammo_remaining() + medium.ammo_remaining() == 0 );
+    }
+    SECTION( "charge beyond the capacity is returned" ) {
+        const int capacity = small_capacity + medium_capacity;
+        CHECK( veh_ptr->charge_battery( capacity + 7, false ) == 7 );
+        CHECK( small.ammo_remaining() == small_capacity );
+        CHECK( medium.ammo_remaining() == medium_capacity );
+        CHECK( veh_ptr->discharge_battery( capacity + 7, false ) == 7 );
+        CHECK( small.ammo_remaining() == 0 );
+        CHECK( medium.ammo_remaining() == 0 );
+    }
+}
+
+TEST_CASE( "vehicle_power_grid_follows_cables" )
+{
+    clear_map();
+    vehicle *source = battery_test_vehicle( tripoint( 10, 10, 0 ) );
+    vehicle *target = battery_test_vehicle( tripoint( 20, 10, 0 ) );
+    REQUIRE( source->connected_power_grid().empty() );
+
+    // Connect them the same way the jumper cable item does
+    const vpart_id cable( "jumper_cable_debug" );
+    vehicle_part source_part( cable, point_zero, item( cable->item ) );
+    source_part.target.first = g->m.getabs( target->global_pos3() );
+    source_part.target.second = g->m.getabs( target->global_pos3() );
+    const int source_cable = source->install_part( point_zero, source_part );
+    REQUIRE( source_cable >= 0 );
+    vehicle_part target_part( cable, point_zero, item( cable->item ) );
+    target_part.target.first = g->m.getabs( source->global_pos3() );
+    target_part.target.second = g->m.getabs( source->global_pos3() );
+    REQUIRE( target->install_part( point_zero, target_part ) >= 0 );
+
+    REQUIRE( source->connected_power_grid().size() == 1 );
+    CHECK( source->connected_power_grid().front().first == target );
+    REQUIRE( target->connected_power_grid().size() == 1 );
+    CHECK( target->connected_power_grid().front().first == source );
+
+    // What doesn't fit into the source goes over the cable
+    const int capacity = source->fuel_capacity( fuel_type_battery );
+    CHECK( source->charge_battery( capacity + 100 ) == 0 );
+    CHECK( source->fuel_left( fuel_type_battery ) == capacity );
+    CHECK( target->fuel_left( fuel_type_battery ) == 100 );
+
+    source->remove_part( source_cable );
+    source->part_removal_cleanup();
+    CHECK( source->connected_power_grid().empty() );
+}
@@ -6,7 +6,12 @@
 #include "game.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "mapdata.h"
+#include "monster.h"
 #include "vehicle.h"
+#include "veh_type.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 #include "enums.h"
 #include "type_id.h"
 #include "point.h"
@@ -69,3 +74,131 @@ TEST_CASE( "add_item_to_broken_vehicle_part" )
     const item itm2 = item( "jeans" );
     REQUIRE( !veh_ptr->add_item( *cargo_part, itm2 ) );
 }
+
+static std::vector<int> scan_parts_with_flag( const vehicle &veh, const vpart_bitflags flag )
+{
+    std::vector<int> found;
+    for( size_t p = 0; p < veh.parts.size(); p++ ) {
+        if( !veh.parts[p].removed && veh.parts[p].info().has_flag( flag ) ) {
+            found.push_back( static_cast<int>( p ) );
+        }
+    }
+    return found;
+}
+
+static std::vector<int> ranged_parts_with_flag( const vehicle &veh, const vpart_bitflags flag )
+{
+    std::vector<int> found;
+    for( const vpart_reference &vp : veh.get_any_parts( flag ) ) {
+        found.push_back( static_cast<int>( vp.part_index() ) );
+    }
+    return found;
+}
+
+TEST_CASE( "vehicle_flag_ranges_match_part_scan" )
+{
+    clear_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "car" ), vehicle_origin, 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    REQUIRE( veh_ptr->parts_with_flag( VPFLAG_WHEEL ) != nullptr );
+
+    const std::vector<vpart_bitflags> flags = {
+        VPFLAG_WHEEL, VPFLAG_CARGO, VPFLAG_ENGINE, VPFLAG_SEATBELT, VPFLAG_CONTROLS
+    };
+    for( const vpart_bitflags flag : flags ) {
+        CHECK( ranged_parts_with_flag( *veh_ptr, flag ) == scan_parts_with_flag( *veh_ptr, flag ) );
+    }
+
+    const std::vector<int> wheels = scan_parts_with_flag( *veh_ptr, VPFLAG_WHEEL );
+    REQUIRE( !wheels.empty() );
+    veh_ptr->remove_part( wheels.front() );
+    CHECK( ranged_parts_with_flag( *veh_ptr, VPFLAG_WHEEL ) ==
+           scan_parts_with_flag( *veh_ptr, VPFLAG_WHEEL ) );
+    veh_ptr->part_removal_cleanup();
+    CHECK( ranged_parts_with_flag( *veh_ptr, VPFLAG_WHEEL ) ==
+           scan_parts_with_flag( *veh_ptr, VPFLAG_WHEEL ) );
+}
+
+static std::vector<veh_collision> detect_collisions( vehicle &veh, const tripoint &dp )
+{
+    // Not turning, so the parts end up where they are now shifted by dp
+    veh.precalc_mounts( 1, veh.pivot_rotation[0], veh.pivot_anchor[0] );
+    std::vector<veh_collision> colls;
+    veh.collision( colls, dp, true );
+    return colls;
+}
+
+TEST_CASE( "vehicle_collision_detects_walls_critters_and_vehicles" )
+{
+    clear_map_and_put_player_underground();
+    const tripoint origin( 60, 60, 0 );
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "bicycle" ), origin, 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+
+    tripoint front = veh_ptr->global_part_pos3( 0 );
+    for( const vpart_reference &vp : veh_ptr->get_all_parts() ) {
+        const tripoint pos = vp.pos();
+        if( pos.x > front.x ) {
+            front = pos;
+        }
+    }
+    const tripoint ahead = front + tripoint_east;
+
+    SECTION( "open ground" ) {
+        CHECK( detect_collisions( *veh_ptr, tripoint_east ).empty() );
+    }
+    SECTION( "wall" ) {
+        g->m.ter_set( ahead, t_wall );
+        const std::vector<veh_collision> colls = detect_collisions( *veh_ptr, tripoint_east );
+        REQUIRE( colls.size() == 1 );
+        const veh_coll_type type = colls.front().type;
+        CHECK( ( type == veh_coll_bashable || type == veh_coll_other ) );
+    }
+    SECTION( "critter" ) {
+        monster &zombie = spawn_test_monster( "mon_zombie", ahead );
+        const std::vector<veh_collision> colls = detect_collisions( *veh_ptr, tripoint_east );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls.front().type == veh_coll_body );
+        CHECK( colls.front().target == &zombie );
+    }
+    SECTION( "parked vehicle" ) {
+        const tripoint offset( 10, 0, 0 );
+        vehicle *parked = g->m.add_vehicle( vproto_id( "bicycle" ), origin + offset, 0, 0, 0 );
+        REQUIRE( parked != nullptr );
+        CHECK( detect_collisions( *veh_ptr, tripoint_east ).empty() );
+        const std::vector<veh_collision> colls = detect_collisions( *veh_ptr, offset );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls.front().type == veh_coll_veh );
+        CHECK( colls.front().target == parked );
+    }
+}
+
+TEST_CASE( "vehicle_wheel_traction_follows_terrain_and_wheels" )
+{
+    clear_map();
+    const tripoint origin( 60, 60, 0 );
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "car" ), origin, -90, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    veh.check_falling_or_floating();
+    REQUIRE( !veh.wheelcache.empty() );
+
+    const float on_grass = g->m.vehicle_wheel_traction( veh );
+    CHECK( on_grass > 0.0f );
+    CHECK( g->m.vehicle_wheel_traction( veh ) == on_grass );
+
+    // Changing the terrain under the wheels changes the traction right away
+    const tripoint wheel = veh.global_part_pos3( veh.wheelcache.front() );
+    const ter_id old_ter = g->m.ter( wheel );
+    g->m.ter_set( wheel, t_underbrush );
+    const float in_underbrush = g->m.vehicle_wheel_traction( veh );
+    CHECK( in_underbrush < on_grass );
+    g->m.ter_set( wheel, old_ter );
+    CHECK( g->m.vehicle_wheel_traction( veh ) == on_grass );
+
+    // So does losing a wheel
+    veh.remove_part( veh.wheelcache.front() );
+    veh.part_removal_cleanup();
+    CHECK( g->m.vehicle_wheel_traction( veh ) < on_grass );
+}
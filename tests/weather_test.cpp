@@ -4,6 +4,7 @@
 
 #include "calendar.h"
 #include "point.h"
+#include "weather.h"
 #include "weather_gen.h"
 #include "game.h"
 
@@ -110,3 +111,20 @@ TEST_CASE( "weather realism" )
         CHECK( heavy_precip <= .02 );
     }
 }
+
+TEST_CASE( "weather_sums_over_long_intervals" )
+{
+    g->weather.weather_override = WEATHER_DRIZZLE;
+    const time_point start = calendar::turn_zero + 3_days + 5_hours + 7_minutes;
+    const time_point end = start + 40_days;
+    const weather_sum total = sum_conditions( start, end, tripoint_zero );
+    CHECK( total.rain_amount == 4 * to_turns<int>( end - start ) );
+
+    // Summing day by day samples every minute, the long interval only samples hourly.
+    float daily_sunlight = 0.0f;
+    for( time_point t = start; t < end; t += 1_days ) {
+        daily_sunlight += sum_conditions( t, t + 1_days, tripoint_zero ).sunlight;
+    }
+    CHECK( total.sunlight == Approx( daily_sunlight ).epsilon( 0.02 ) );
+    g->weather.weather_override = WEATHER_NULL;
+}